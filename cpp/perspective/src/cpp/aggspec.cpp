@@ -193,6 +193,12 @@ t_aggspec::agg_str() const {
         case AGGTYPE_PCT_SUM_GRAND_TOTAL: {
             return "pct_sum_grand_total";
         }
+        case AGGTYPE_MAX: {
+            return "max";
+        }
+        case AGGTYPE_MIN: {
+            return "min";
+        }
         default: {
             PSP_COMPLAIN_AND_ABORT("Unknown agg type");
             return "unknown";
@@ -304,6 +310,8 @@ t_aggspec::get_output_specs(const t_schema& schema) const {
         case AGGTYPE_LAST_VALUE:
         case AGGTYPE_HIGH_WATER_MARK:
         case AGGTYPE_LOW_WATER_MARK:
+        case AGGTYPE_MAX:
+        case AGGTYPE_MIN:
         case AGGTYPE_IDENTITY:
         case AGGTYPE_DISTINCT_LEAF: {
             t_dtype coltype = schema.get_dtype(m_dependencies[0].name());
@@ -384,6 +392,90 @@ t_aggspec::is_non_delta() const {
     return false;
 }
 
+// Aggregates which are computed by reducing every row under a node from the
+// gstate, rather than from the strand deltas of the node.
+bool
+t_aggspec::is_non_decomposable() const {
+    switch (m_agg) {
+        case AGGTYPE_UNIQUE:
+        case AGGTYPE_OR:
+        case AGGTYPE_ANY:
+        case AGGTYPE_MEDIAN:
+        case AGGTYPE_JOIN:
+        case AGGTYPE_DOMINANT:
+        case AGGTYPE_FIRST:
+        case AGGTYPE_LAST_BY_INDEX:
+        case AGGTYPE_AND:
+        case AGGTYPE_DISTINCT_COUNT:
+        case AGGTYPE_DISTINCT_LEAF:
+        case AGGTYPE_MAX:
+        case AGGTYPE_MIN: {
+            return true;
+        }
+        default:
+            return false;
+    }
+    return false;
+}
+
+// Means whose (numerator, denominator) are accumulated from the strand deltas
+// rather than re-read from the gstate for every updated node.
+bool
+t_aggspec::is_incremental_mean() const {
+    t_uindex ndeps;
+    switch (m_agg) {
+        case AGGTYPE_MEAN: {
+            ndeps = 1;
+        } break;
+        case AGGTYPE_WEIGHTED_MEAN: {
+            ndeps = 2;
+        } break;
+        default:
+            return false;
+    }
+
+    if (m_dependencies.size() != ndeps)
+        return false;
+
+    for (const auto& dep : m_dependencies) {
+        if (dep.type() != DEPTYPE_COLUMN)
+            return false;
+    }
+
+    return true;
+}
+
+std::string
+t_aggspec::get_mean_numerator_colname() const {
+    return "psp_mean_nr|" + m_name;
+}
+
+std::string
+t_aggspec::get_mean_denominator_colname() const {
+    return "psp_mean_dr|" + m_name;
+}
+
+// Maxima and minima which are updated from the extremes of the values
+// entering and leaving each node, and only re-read from the gstate when the
+// current extreme may have left it.
+bool
+t_aggspec::is_incremental_extreme() const {
+    if (m_agg != AGGTYPE_MAX && m_agg != AGGTYPE_MIN)
+        return false;
+
+    return m_dependencies.size() == 1 && m_dependencies[0].type() == DEPTYPE_COLUMN;
+}
+
+std::string
+t_aggspec::get_extreme_in_colname() const {
+    return "psp_extreme_in|" + m_name;
+}
+
+std::string
+t_aggspec::get_extreme_out_colname() const {
+    return "psp_extreme_out|" + m_name;
+}
+
 std::string
 t_aggspec::get_first_depname() const {
     if (m_dependencies.empty())
@@ -12,9 +12,14 @@
 #include <arrow/util/value_parsing.h>
 #include <arrow/io/memory.h>
 
+#ifdef PSP_ENABLE_WASM
 // This causes build warnings
 // https://github.com/emscripten-core/emscripten/issues/8574
 #include <perspective/vendor/arrow_single_threaded_reader.h>
+#else
+#include <arrow/csv/reader.h>
+#include <arrow/io/file.h>
+#endif
 
 namespace perspective {
 namespace apachearrow {
@@ -173,28 +178,44 @@ namespace apachearrow {
         return -1;
     }
 
-    std::shared_ptr<::arrow::Table>
-    csvToTable(std::string& csv, bool is_update,
+    arrow::csv::ConvertOptions
+    getCsvConvertOptions(bool is_update,
         std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
             schema) {
-        arrow::MemoryPool* pool = arrow::default_memory_pool();
-        auto input = std::make_shared<arrow::io::BufferReader>(csv);
-        auto read_options = arrow::csv::ReadOptions::Defaults();
-        auto parse_options = arrow::csv::ParseOptions::Defaults();
         auto convert_options = arrow::csv::ConvertOptions::Defaults();
-
-        read_options.use_threads = false;
-
         if (is_update) {
             convert_options.column_types = std::move(schema);
             convert_options.timestamp_parsers = DATE_READERS;
         } else {
             convert_options.timestamp_parsers = DATE_PARSERS;
         }
+        return convert_options;
+    }
+
+    std::shared_ptr<::arrow::Table>
+    readCsv(std::shared_ptr<arrow::io::InputStream> input, bool is_update,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema) {
+        arrow::MemoryPool* pool = arrow::default_memory_pool();
+        auto read_options = arrow::csv::ReadOptions::Defaults();
+        auto parse_options = arrow::csv::ParseOptions::Defaults();
+        auto convert_options = getCsvConvertOptions(is_update, schema);
+
+#ifdef PSP_ENABLE_WASM
+        read_options.use_threads = false;
+#else
+        // Blocks are chunked, parsed and converted (including type
+        // inference) on arrow's CPU thread pool.
+        read_options.use_threads = true;
+#endif
 
         auto maybe_reader = arrow::csv::TableReader::Make(
             pool, input, read_options, parse_options, convert_options);
 
+        if (!maybe_reader.ok()) {
+            PSP_COMPLAIN_AND_ABORT(maybe_reader.status().ToString());
+        }
+
         std::shared_ptr<arrow::csv::TableReader> reader = *maybe_reader;
 
         auto maybe_table = reader->Read();
@@ -204,5 +225,78 @@ namespace apachearrow {
         return *maybe_table;
     }
 
+    std::shared_ptr<::arrow::Table>
+    csvToTable(std::string& csv, bool is_update,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema) {
+        auto input = std::make_shared<arrow::io::BufferReader>(csv);
+        return readCsv(input, is_update, schema);
+    }
+
+#ifndef PSP_ENABLE_WASM
+    std::shared_ptr<arrow::io::MemoryMappedFile>
+    openCsvFile(const std::string& path) {
+        auto maybe_file
+            = arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ);
+        if (!maybe_file.ok()) {
+            PSP_COMPLAIN_AND_ABORT(
+                "Could not open CSV `" + path + "`: " + maybe_file.status().ToString());
+        }
+
+        // Reads from a memory-mapped file are zero-copy slices of the
+        // mapping, so blocks are handed to the parser without buffering.
+        return *maybe_file;
+    }
+
+    std::shared_ptr<::arrow::Table>
+    csvFileToTable(const std::string& path, bool is_update,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema) {
+        return readCsv(openCsvFile(path), is_update, schema);
+    }
+
+    /**
+     * @brief Reads the record batches of a table it owns, as
+     * `arrow::TableBatchReader` only borrows the table.
+     */
+    class CsvTableBatchReader : public arrow::RecordBatchReader {
+    public:
+        explicit CsvTableBatchReader(std::shared_ptr<arrow::Table> table)
+            : m_table(std::move(table))
+            , m_reader(*m_table) {}
+
+        std::shared_ptr<arrow::Schema>
+        schema() const override {
+            return m_table->schema();
+        }
+
+        arrow::Status
+        ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override {
+            return m_reader.ReadNext(batch);
+        }
+
+    private:
+        std::shared_ptr<arrow::Table> m_table;
+        arrow::TableBatchReader m_reader;
+    };
+
+    std::shared_ptr<arrow::RecordBatchReader>
+    csvToBatchReader(std::shared_ptr<arrow::io::InputStream> input,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema) {
+        // `csv::StreamingReader` parses and converts on a single thread, so
+        // the blocks are read in parallel first, and handed out per block.
+        return std::make_shared<CsvTableBatchReader>(
+            readCsv(input, true, schema));
+    }
+
+    std::shared_ptr<arrow::RecordBatchReader>
+    csvFileToBatchReader(const std::string& path,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema) {
+        return csvToBatchReader(openCsvFile(path), schema);
+    }
+#endif
+
 } // namespace apachearrow
 } // namespace perspective
\ No newline at end of file
@@ -8,12 +8,18 @@
  */
 
 #include <perspective/arrow_loader.h>
+#include <fstream>
+
+#ifndef PSP_ENABLE_WASM
+#include <arrow/c/bridge.h>
+#include <arrow/io/file.h>
+#endif
 
 namespace perspective {
 namespace apachearrow {
 
     void 
-    load_stream(const uintptr_t ptr, const uint32_t length, std::shared_ptr<arrow::Table>& table) {
+    load_stream(const uintptr_t ptr, const std::int64_t length, std::shared_ptr<arrow::Table>& table) {
         arrow::io::BufferReader buffer_reader(reinterpret_cast<const std::uint8_t*>(ptr), length);
 #if ARROW_VERSION_MAJOR < 1        
         std::shared_ptr<arrow::ipc::RecordBatchReader> batch_reader;
@@ -49,7 +55,7 @@ namespace apachearrow {
     }
 
     void
-    load_file(const uintptr_t ptr, const uint32_t length, std::shared_ptr<arrow::Table>& table) {
+    load_file(const uintptr_t ptr, const std::int64_t length, std::shared_ptr<arrow::Table>& table) {
         arrow::io::BufferReader buffer_reader(reinterpret_cast<const std::uint8_t*>(ptr), length);
 #if ARROW_VERSION_MAJOR < 1
         std::shared_ptr<arrow::ipc::RecordBatchFileReader> batch_reader;
@@ -112,7 +118,8 @@ namespace apachearrow {
 
     using namespace perspective;
 
-    ArrowLoader::ArrowLoader() {}
+    ArrowLoader::ArrowLoader()
+        : m_batch_idx(0) {}
     ArrowLoader::~ArrowLoader() {}
     
     t_dtype
@@ -155,7 +162,7 @@ namespace apachearrow {
     }
 
     void
-    ArrowLoader::initialize(const uintptr_t ptr, const uint32_t length) {
+    ArrowLoader::initialize(const uintptr_t ptr, const std::int64_t length) {
         arrow::io::BufferReader buffer_reader(reinterpret_cast<const std::uint8_t*>(ptr), length);
         if (std::memcmp("ARROW1", (const void *)ptr, 6) == 0) {
             load_file(ptr, length, m_table);
@@ -163,90 +170,261 @@ namespace apachearrow {
             load_stream(ptr, length, m_table);
         }
 
-        std::shared_ptr<arrow::Schema> schema = m_table->schema();
-        std::vector<std::shared_ptr<arrow::Field>> fields = schema->fields();
-
-        for (auto field : fields) {
-            m_names.push_back(field->name());
-            m_types.push_back(convert_type(field->type()->name()));
-        }
+        init_names_and_types(*m_table->schema());
     }
 
-#ifdef PSP_ENABLE_WASM
+#if ARROW_VERSION_MAJOR >= 1
     void
     ArrowLoader::init_csv(std::string& csv, bool is_update,  std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& psp_schema) {        
         m_table = csvToTable(csv, is_update, psp_schema);
+        init_names_and_types(*m_table->schema());
+    }
 
-        std::shared_ptr<arrow::Schema> schema = m_table->schema();
-        std::vector<std::shared_ptr<arrow::Field>> fields = schema->fields();
+#ifndef PSP_ENABLE_WASM
+    void
+    ArrowLoader::init_csv_file(const std::string& path, bool is_update,  std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& psp_schema) {        
+        m_table = csvFileToTable(path, is_update, psp_schema);
+        init_names_and_types(*m_table->schema());
+    }
 
-        for (auto field : fields) {
-            m_names.push_back(field->name());
-            m_types.push_back(convert_type(field->type()->name()));
-        }
+    void
+    ArrowLoader::init_csv_batches(const std::string& csv, std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& psp_schema) {
+        m_batch_idx = 0;
+        m_file_reader = nullptr;
+        m_batch_source = nullptr;
+        m_stream_reader = csvToBatchReader(std::make_shared<arrow::io::BufferReader>(csv), psp_schema);
+        m_batch_schema = m_stream_reader->schema();
+        init_names_and_types(*m_batch_schema);
+    }
+
+    void
+    ArrowLoader::init_csv_file_batches(const std::string& path, std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& psp_schema) {
+        m_batch_idx = 0;
+        m_file_reader = nullptr;
+        m_batch_source = nullptr;
+        m_stream_reader = csvFileToBatchReader(path, psp_schema);
+        m_batch_schema = m_stream_reader->schema();
+        init_names_and_types(*m_batch_schema);
     }
 #endif
 
     void
-    ArrowLoader::fill_table(
-        t_data_table& tbl, 
-        const t_schema& input_schema,
-        const std::string& index,
-        std::uint32_t offset,
-        std::uint32_t limit,
-        bool is_update) {
-        bool implicit_index = false;
-        std::shared_ptr<arrow::Schema> schema = m_table->schema();
-        std::vector<std::shared_ptr<arrow::Field>> fields = schema->fields();
+    ArrowLoader::init_batches(uintptr_t ptr, std::int64_t length) {
+        init_batches_source(std::make_shared<arrow::io::BufferReader>(
+            reinterpret_cast<const std::uint8_t*>(ptr), length));
+    }
 
-        for (long unsigned int cidx = 0; cidx < m_names.size(); ++cidx) {
-            auto name = m_names[cidx];
-            t_dtype type = m_types[cidx];
+#ifndef PSP_ENABLE_WASM
+    void
+    ArrowLoader::init_batches_file(const std::string& path) {
+        auto maybe_file
+            = arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ);
+        if (!maybe_file.ok()) {
+            PSP_COMPLAIN_AND_ABORT(
+                "Could not open arrow `" + path + "`: " + maybe_file.status().ToString());
+        }
+        init_batches_source(*maybe_file);
+    }
 
-            if (!input_schema.has_column(name)) {
-                // Skip columns that are defined in the arrow but not 
-                // in the Table's input schema.
-                continue;
-            }
+    bool
+    ArrowLoader::is_arrow_file(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        char magic[6] = {0};
+        file.read(magic, sizeof(magic));
+        if (file.gcount() < 4) {
+            return false;
+        }
 
-            auto raw_type = fields[cidx]->type()->name();
+        // Files begin with `ARROW1`, and streams with a continuation token.
+        const char continuation[4] = {'\xff', '\xff', '\xff', '\xff'};
+        return (file.gcount() == 6 && std::memcmp(magic, "ARROW1", 6) == 0)
+            || std::memcmp(magic, continuation, 4) == 0;
+    }
 
-            if (name == "__INDEX__") {
-                implicit_index = true;
-                std::shared_ptr<t_column> pkey_col_sptr
-                    = tbl.add_column_sptr("psp_pkey", type, true);
-                fill_column(tbl, pkey_col_sptr, "psp_pkey", cidx, type, raw_type, is_update);
-                tbl.clone_column("psp_pkey", "psp_okey");
-                continue;
-            } else {
-                auto col = tbl.get_column(name);
-                fill_column(tbl, col, name, cidx, type, raw_type, is_update);
+    void
+    ArrowLoader::init_batches_c_stream(struct ArrowArrayStream* stream) {
+        auto maybe_reader = arrow::ImportRecordBatchReader(stream);
+        if (!maybe_reader.ok()) {
+            PSP_COMPLAIN_AND_ABORT(
+                "Failed to import arrow C stream: " + maybe_reader.status().ToString());
+        }
+
+        m_batch_idx = 0;
+        m_file_reader = nullptr;
+        m_batch_source = nullptr;
+        m_stream_reader = *maybe_reader;
+        m_batch_schema = m_stream_reader->schema();
+        init_names_and_types(*m_batch_schema);
+    }
+#endif
+
+    void
+    ArrowLoader::init_batches_source(std::shared_ptr<arrow::io::RandomAccessFile> source) {
+        m_batch_source = source;
+        m_batch_idx = 0;
+        m_stream_reader = nullptr;
+        m_file_reader = nullptr;
+
+        auto maybe_magic = source->ReadAt(0, 6);
+        bool is_file = maybe_magic.ok() && (*maybe_magic)->size() == 6
+            && std::memcmp((*maybe_magic)->data(), "ARROW1", 6) == 0;
+
+        if (is_file) {
+            auto maybe_reader = arrow::ipc::RecordBatchFileReader::Open(source);
+            if (!maybe_reader.ok()) {
+                PSP_COMPLAIN_AND_ABORT(
+                    "Failed to open RecordBatchFileReader: " + maybe_reader.status().ToString());
+            }
+            m_file_reader = *maybe_reader;
+            m_batch_schema = m_file_reader->schema();
+        } else {
+            auto maybe_reader = arrow::ipc::RecordBatchStreamReader::Open(source);
+            if (!maybe_reader.ok()) {
+                PSP_COMPLAIN_AND_ABORT(
+                    "Failed to open RecordBatchStreamReader: " + maybe_reader.status().ToString());
             }
+            m_stream_reader = *maybe_reader;
+            m_batch_schema = m_stream_reader->schema();
         }
 
-        // Fill index column - recreated every time a `t_data_table` is created.
-        if (!implicit_index) {
-            if (index == "") {
-                // Use row number as index if not explicitly provided or provided with
-                // `__INDEX__`
-                auto key_col = tbl.add_column("psp_pkey", DTYPE_INT32, true);
-                auto okey_col = tbl.add_column("psp_okey", DTYPE_INT32, true);
-
-                for (std::uint32_t ridx = 0; ridx < tbl.size(); ++ridx) {
-                    key_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
-                    okey_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
+        init_names_and_types(*m_batch_schema);
+    }
+
+    bool
+    ArrowLoader::next_batch() {
+        std::shared_ptr<arrow::RecordBatch> batch;
+
+        if (m_file_reader != nullptr) {
+            if (m_batch_idx < m_file_reader->num_record_batches()) {
+                auto maybe_batch = m_file_reader->ReadRecordBatch(m_batch_idx++);
+                if (!maybe_batch.ok()) {
+                    PSP_COMPLAIN_AND_ABORT(
+                        "Failed to read file record batch: " + maybe_batch.status().ToString());
                 }
-            } else {
-                if (!input_schema.has_column(index)) {
+                batch = *maybe_batch;
+            }
+        } else if (m_stream_reader != nullptr) {
+            auto status = m_stream_reader->ReadNext(&batch);
+            if (!status.ok()) {
+                PSP_COMPLAIN_AND_ABORT(
+                    "Failed to read stream record batch: " + status.ToString());
+            }
+        }
+
+        std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+        if (batch != nullptr) {
+            batches.push_back(batch);
+        }
+
+        auto maybe_table = arrow::Table::FromRecordBatches(m_batch_schema, batches);
+        if (!maybe_table.ok()) {
+            PSP_COMPLAIN_AND_ABORT(
+                "Failed to create Table from RecordBatches: " + maybe_table.status().ToString());
+        }
+        m_table = *maybe_table;
+
+        if (batch == nullptr) {
+            // Release the readers and the source, e.g. the memory map.
+            m_stream_reader = nullptr;
+            m_file_reader = nullptr;
+            m_batch_source = nullptr;
+            return false;
+        }
+
+        return true;
+    }
+#endif
+
+    void
+    ArrowLoader::init_names_and_types(const arrow::Schema& schema) {
+        const std::vector<std::shared_ptr<arrow::Field>>& fields = schema.fields();
+
+        for (auto field : fields) {
+            m_names.push_back(field->name());
+            m_types.push_back(convert_type(field->type()->name()));
+        }
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>
+    get_csv_column_types(const t_schema& schema) {
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>> map;
+        const std::vector<std::string>& column_names = schema.columns();
+        const std::vector<t_dtype>& data_types = schema.types();
+
+        for (auto idx = 0; idx < column_names.size(); ++idx) {
+            const std::string& name = column_names[idx];
+            const t_dtype& type = data_types[idx];
+            switch (type) {
+                case DTYPE_FLOAT32:
+                    map[name] = std::make_shared<arrow::FloatType>();
+                    break;
+                case DTYPE_FLOAT64:
+                    map[name] = std::make_shared<arrow::DoubleType>();
+                    break;
+                case DTYPE_STR:
+                    map[name] = std::make_shared<arrow::StringType>();
+                    break;
+                case DTYPE_BOOL:
+                    map[name] = std::make_shared<arrow::BooleanType>();
+                    break;
+                case DTYPE_UINT32:
+                    map[name] = std::make_shared<arrow::UInt32Type>();
+                    break;
+                case DTYPE_UINT64:
+                    map[name] = std::make_shared<arrow::UInt64Type>();
+                    break;                  
+                case DTYPE_INT32:
+                    map[name] = std::make_shared<arrow::Int32Type>();
+                    break;
+                case DTYPE_INT64:
+                    map[name] = std::make_shared<arrow::Int64Type>();
+                    break;
+                case DTYPE_TIME:
+                    map[name] = std::make_shared<arrow::TimestampType>();
+                    break;                       
+                case DTYPE_DATE:
+                    map[name] = std::make_shared<arrow::Date64Type>();
+                    break;
+                default:
                     std::stringstream ss;
-                    ss << "Specified index `" << index << "` is invalid as it does not appear in the Table." << std::endl;
-                    PSP_COMPLAIN_AND_ABORT(ss.str());
-                }
+                    ss << "Error loading arrow type " << dtype_to_str(type) << " for column " << name << std::endl;
+                    PSP_COMPLAIN_AND_ABORT(ss.str())
+                    break;
+            }
+        }
 
-                tbl.clone_column(index, "psp_pkey");
-                tbl.clone_column(index, "psp_okey");
+        return map;
+    }
+
+    std::vector<t_loader_column>
+    ArrowLoader::get_loader_columns(const t_schema& input_schema) const {
+        std::vector<t_loader_column> sources;
+
+        for (long unsigned int cidx = 0; cidx < m_names.size(); ++cidx) {
+            if (!input_schema.has_column(m_names[cidx])) {
+                // Skip columns that are defined in the arrow but not
+                // in the Table's input schema.
+                continue;
             }
+
+            sources.push_back(t_loader_column{
+                m_names[cidx], static_cast<std::int32_t>(cidx), m_types[cidx]});
         }
+
+        return sources;
+    }
+
+    void
+    ArrowLoader::fill_column(t_data_table& tbl, std::shared_ptr<t_column> col,
+        const std::string& name, const t_loader_column& source, bool is_update) {
+        std::shared_ptr<arrow::Schema> schema = m_table->schema();
+        auto raw_type = schema->field(source.m_cidx)->type()->name();
+        fill_column(tbl, col, name, source.m_cidx, source.m_type, raw_type, is_update);
+    }
+
+    bool
+    ArrowLoader::is_fill_parallel() const {
+        return true;
     }
 
     template <typename T, typename V>
@@ -260,15 +438,29 @@ namespace apachearrow {
         }
     }
 
+    template <typename T>
+    void
+    iter_col_remap(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> src,
+        const std::vector<t_uindex>& remap, const int64_t offset, const int64_t len) {
+        std::shared_ptr<T> scol = std::static_pointer_cast<T>(src);
+        const typename T::value_type* vals = scol->raw_values();
+        t_uindex* out = dest->get_nth<t_uindex>(offset);
+        for (int64_t i = 0; i < len; i++) {
+            // Null slots may hold any index, and their validity is cleared
+            // afterwards, so only in-range indices are looked up.
+            t_uindex didx = static_cast<t_uindex>(vals[i]);
+            out[i] = didx < remap.size() ? remap[didx] : 0;
+        }
+    }
+
     void
     copy_array(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> src,
         const int64_t offset, const int64_t len) {
         switch (src->type()->id()) {
             case arrow::DictionaryType::type_id: {
-                // If there are duplicate values in the dictionary at different
-                // indices, i.e. [0 => a, 1 => b, 2 => a], tables with
-                // explicit indexes on a string column created from a dictionary
-                // array may have duplicate primary keys.
+                // Intern the dictionary once, then write each index through
+                // the resulting remap - duplicate dictionary values and
+                // strings already in the vocab resolve to the same id.
                 auto scol = std::static_pointer_cast<arrow::DictionaryArray>(src);
                 std::shared_ptr<arrow::StringArray> dict
                     = std::static_pointer_cast<arrow::StringArray>(scol->dictionary());
@@ -276,40 +468,43 @@ namespace apachearrow {
                 const uint8_t* values = dict->value_data()->data();
                 const std::uint64_t dsize = dict->length();
 
-                t_vocab* vocab = dest->_get_vocab();
-                std::string elem;
+                std::vector<const char*> strs(dsize);
+                std::vector<std::uint32_t> lengths(dsize);
+                std::vector<t_uindex> remap(dsize);
 
                 for (std::uint64_t i = 0; i < dsize; ++i) {
-                    std::int32_t bidx = offsets[i];
-                    std::size_t es = offsets[i + 1] - bidx;
-                    elem.assign(reinterpret_cast<const char*>(values) + bidx, es);
-                    vocab->get_interned(elem);
+                    strs[i] = reinterpret_cast<const char*>(values) + offsets[i];
+                    lengths[i] = offsets[i + 1] - offsets[i];
                 }
+
+                dest->_get_vocab()->intern_many(
+                    strs.data(), lengths.data(), dsize, remap.data());
+
                 auto indices = scol->indices();
                 switch (indices->type()->id()) {
                     case arrow::Int8Type::type_id: {
-                        iter_col_copy<::arrow::Int8Array, t_uindex>(dest, indices, offset, len);                    
+                        iter_col_remap<::arrow::Int8Array>(dest, indices, remap, offset, len);
                     } break;
                     case ::arrow::UInt8Type::type_id: {
-                        iter_col_copy<::arrow::UInt8Array, t_uindex>(dest, indices, offset, len);
+                        iter_col_remap<::arrow::UInt8Array>(dest, indices, remap, offset, len);
                     } break;
                     case ::arrow::Int16Type::type_id: {
-                        iter_col_copy<::arrow::Int16Array, t_uindex>(dest, indices, offset, len);
+                        iter_col_remap<::arrow::Int16Array>(dest, indices, remap, offset, len);
                     } break;
                     case ::arrow::UInt16Type::type_id: {
-                        iter_col_copy<::arrow::UInt16Array, t_uindex>(dest, indices, offset, len);
+                        iter_col_remap<::arrow::UInt16Array>(dest, indices, remap, offset, len);
                     } break;
                     case ::arrow::Int32Type::type_id: {
-                        iter_col_copy<::arrow::Int32Array, t_uindex>(dest, indices, offset, len);
+                        iter_col_remap<::arrow::Int32Array>(dest, indices, remap, offset, len);
                     } break;
                     case ::arrow::UInt32Type::type_id: {
-                        iter_col_copy<::arrow::UInt32Array, t_uindex>(dest, indices, offset, len);
+                        iter_col_remap<::arrow::UInt32Array>(dest, indices, remap, offset, len);
                     } break;
                     case ::arrow::Int64Type::type_id: {
-                        iter_col_copy<::arrow::Int64Array, t_uindex>(dest, indices, offset, len);
+                        iter_col_remap<::arrow::Int64Array>(dest, indices, remap, offset, len);
                     } break;
                     case ::arrow::UInt64Type::type_id: {
-                        iter_col_copy<::arrow::UInt64Array, t_uindex>(dest, indices, offset, len);
+                        iter_col_remap<::arrow::UInt64Array>(dest, indices, remap, offset, len);
                     } break;
                     default: {
                         std::stringstream ss;
@@ -326,14 +521,16 @@ namespace apachearrow {
                 const int32_t* offsets = scol->raw_value_offsets();
                 const uint8_t* values = scol->value_data()->data();
 
-                std::string elem;
+                std::vector<const char*> strs(len);
+                std::vector<std::uint32_t> lengths(len);
 
-                for (std::uint32_t i = 0; i < len; ++i) {
-                    std::int32_t bidx = offsets[i];
-                    std::size_t es = offsets[i + 1] - bidx;
-                    elem.assign(reinterpret_cast<const char*>(values) + bidx, es);
-                    dest->set_nth(offset + i, elem);
+                for (std::int64_t i = 0; i < len; ++i) {
+                    strs[i] = reinterpret_cast<const char*>(values) + offsets[i];
+                    lengths[i] = offsets[i + 1] - offsets[i];
                 }
+
+                dest->_get_vocab()->intern_many(
+                    strs.data(), lengths.data(), len, dest->get_nth<t_uindex>(offset));
             } break;
             case arrow::Int8Type::type_id: {
                 auto scol = std::static_pointer_cast<arrow::Int8Array>(src);
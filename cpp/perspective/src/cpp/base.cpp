@@ -613,6 +613,10 @@ str_to_aggtype(const std::string& str) {
         return t_aggtype::AGGTYPE_PCT_SUM_PARENT;
     } else if (str == "pct sum grand total" || str == "pct_sum_grand_total") {
         return t_aggtype::AGGTYPE_PCT_SUM_GRAND_TOTAL;
+    } else if (str == "max") {
+        return t_aggtype::AGGTYPE_MAX;
+    } else if (str == "min") {
+        return t_aggtype::AGGTYPE_MIN;
     } else if (str.find("udf_combiner_") != std::string::npos) {
         return t_aggtype::AGGTYPE_UDF_COMBINER;
     } else if (str.find("udf_reducer_") != std::string::npos) {
@@ -373,6 +373,38 @@ t_column::get_vlenidx() const {
     return m_vocab->get_vlenidx();
 }
 
+t_uindex
+t_column::compact_vocabulary() {
+    COLUMN_CHECK_STRCOL();
+
+    t_uindex vlenidx = m_vocab->get_vlenidx();
+    if (vlenidx == 0) {
+        return 0;
+    }
+
+    // Null and cleared rows store id 0, so it is always kept.
+    std::vector<bool> used(vlenidx, false);
+    used[0] = true;
+
+    for (t_uindex idx = 0, loop_end = size(); idx < loop_end; ++idx) {
+        if (is_valid(idx)) {
+            used[*(m_data->get_nth<t_uindex>(idx))] = true;
+        }
+    }
+
+    std::vector<t_uindex> remap;
+    t_uindex dropped = m_vocab->compact(used, remap);
+
+    if (dropped > 0) {
+        for (t_uindex idx = 0, loop_end = size(); idx < loop_end; ++idx) {
+            t_uindex* sidx = m_data->get_nth<t_uindex>(idx);
+            *sidx = used[*sidx] ? remap[*sidx] : 0;
+        }
+    }
+
+    return dropped;
+}
+
 t_tscalar
 t_column::get_scalar(t_uindex idx) const {
     COLUMN_CHECK_ACCESS(idx);
@@ -194,6 +194,8 @@ t_config::setup(const std::vector<std::string>& detail_columns,
             case AGGTYPE_MUL:
             case AGGTYPE_DISTINCT_COUNT:
             case AGGTYPE_DISTINCT_LEAF:
+            case AGGTYPE_MAX:
+            case AGGTYPE_MIN:
                 m_has_pkey_agg = true;
                 break;
             default:
@@ -440,6 +440,12 @@ t_ctx_grouped_pkey::reset_step_state() {
     }
 }
 
+bool
+t_ctx_grouped_pkey::get_column_dependencies(std::vector<std::string>& columns) const {
+    // Rebuilt from the gnode state on every update.
+    return false;
+}
+
 std::vector<t_stree*>
 t_ctx_grouped_pkey::get_trees() {
     PSP_TRACE_SENTINEL();
@@ -33,6 +33,7 @@ t_ctx1::init() {
     auto pivots = m_config.get_row_pivots();
     m_tree = std::make_shared<t_stree>(pivots, m_config.get_aggregates(), m_schema, m_config);
     m_tree->init();
+    m_tree->set_lazy_aggregates(true);
     m_traversal = std::shared_ptr<t_traversal>(new t_traversal(m_tree));
     m_init = true;
 }
@@ -76,6 +77,12 @@ t_ctx1::open(t_index idx) {
     if (idx >= t_index(m_traversal->size()))
         return 0;
 
+    // The children are sorted by their aggregates as they are inserted.
+    if (m_tree->has_stale_aggregates()) {
+        t_index nidx = m_traversal->get_tree_index(idx);
+        m_tree->refresh_aggregates(m_tree->get_child_idx(nidx), *m_gstate);
+    }
+
     t_index retval = m_traversal->expand_node(m_sortby, idx);
     m_rows_changed = (retval > 0);
     return retval;
@@ -275,12 +282,27 @@ void
 t_ctx1::step_end() {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    refresh_visible_aggregates();
     sort_by(m_sortby);
     if (m_depth_set) {
         set_depth(m_depth);
     }
 }
 
+void
+t_ctx1::refresh_visible_aggregates() {
+    if (!m_tree->has_stale_aggregates()) {
+        return;
+    }
+
+    std::vector<t_uindex> nidxs(m_traversal->size());
+    for (t_uindex idx = 0, loop_end = nidxs.size(); idx < loop_end; ++idx) {
+        nidxs[idx] = m_traversal->get_tree_index(idx);
+    }
+
+    m_tree->refresh_aggregates(nidxs, *m_gstate);
+}
+
 t_aggspec
 t_ctx1::get_aggregate(t_uindex idx) const {
     PSP_TRACE_SENTINEL();
@@ -342,6 +364,12 @@ t_ctx1::set_depth(t_depth depth) {
     if (m_config.get_num_rpivots() == 0)
         return;
     depth = std::min<t_depth>(m_config.get_num_rpivots() - 1, depth);
+
+    // Expanding to `depth` shows every node down to `depth + 1`.
+    if (m_tree->has_stale_aggregates()) {
+        m_tree->refresh_aggregates(depth + 1, *m_gstate);
+    }
+
     t_index retval = 0;
     retval = m_traversal->set_depth(m_sortby, depth);
     m_rows_changed = (retval > 0);
@@ -509,6 +537,7 @@ t_ctx1::reset() {
     m_tree = std::make_shared<t_stree>(pivots, m_config.get_aggregates(), m_schema, m_config);
     m_tree->init();
     m_tree->set_deltas_enabled(get_feature_state(CTX_FEAT_DELTA));
+    m_tree->set_lazy_aggregates(true);
     m_traversal = std::shared_ptr<t_traversal>(new t_traversal(m_tree));
 }
 
@@ -521,6 +550,12 @@ t_ctx1::reset_step_state() {
     }
 }
 
+bool
+t_ctx1::get_column_dependencies(std::vector<std::string>& columns) const {
+    columns = ctx_get_column_dependencies(m_config);
+    return true;
+}
+
 t_index
 t_ctx1::sidedness() const {
     return 1;
@@ -709,6 +744,10 @@ t_ctx1::unity_init_load_step_end() {}
 
 std::shared_ptr<t_data_table>
 t_ctx1::get_table() const {
+    if (m_tree->has_stale_aggregates()) {
+        m_tree->refresh_aggregates(m_tree->last_level(), *m_gstate);
+    }
+
     auto schema = m_tree->get_aggtable()->get_schema();
     auto pivots = m_config.get_row_pivots();
     auto tbl = std::make_shared<t_data_table>(schema, m_tree->size());
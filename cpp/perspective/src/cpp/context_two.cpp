@@ -895,6 +895,12 @@ t_ctx2::reset_step_state() {
     m_columns_changed = false;
 }
 
+bool
+t_ctx2::get_column_dependencies(std::vector<std::string>& columns) const {
+    columns = ctx_get_column_dependencies(m_config);
+    return true;
+}
+
 void
 t_ctx2::clear_deltas() {
     for (auto& tr : m_trees) {
@@ -45,6 +45,12 @@ t_ctxunit::step_begin() {
 void
 t_ctxunit::step_end() {}
 
+bool
+t_ctxunit::get_column_dependencies(std::vector<std::string>& columns) const {
+    // Shows every column of the table.
+    return false;
+}
+
 /**
  * @brief Notify the context with new data when the `t_gstate` master table is
  * not empty, and being updated with new data.
@@ -309,12 +315,7 @@ t_ctxunit::get_column_name(t_index idx) {
 t_rowdelta
 t_ctxunit::get_row_delta() {
     bool rows_changed = m_rows_changed;
-    std::vector<t_tscalar> pkey_vector(m_delta_pkeys.begin(), m_delta_pkeys.end());
-
-    // Sort pkeys - they will always be integers >= 0, as the table has
-    // no index set.
-    std::sort(pkey_vector.begin(), pkey_vector.end());
-
+    std::vector<t_tscalar> pkey_vector = get_row_delta_pkeys();
     std::vector<t_tscalar> data = get_data(pkey_vector);
     t_rowdelta rval(rows_changed, pkey_vector.size(), data);
     clear_deltas();
@@ -327,6 +328,16 @@ t_ctxunit::get_delta_pkeys() const {
     return m_delta_pkeys;
 }
 
+std::vector<t_tscalar>
+t_ctxunit::get_row_delta_pkeys() const {
+    std::vector<t_tscalar> pkey_vector(m_delta_pkeys.begin(), m_delta_pkeys.end());
+
+    // Sort pkeys - they will always be integers >= 0, as the table has
+    // no index set.
+    std::sort(pkey_vector.begin(), pkey_vector.end());
+    return pkey_vector;
+}
+
 std::vector<std::string>
 t_ctxunit::get_column_names() const {
     return m_schema.columns();
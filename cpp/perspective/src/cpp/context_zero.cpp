@@ -63,6 +63,34 @@ t_ctx0::step_end() {
     }
 
     m_traversal->step_end();
+
+    if (m_traversal->needs_rescan()) {
+        rescan();
+    }
+}
+
+void
+t_ctx0::rescan() {
+    auto tbl = m_gstate->get_pkeyed_table();
+    std::shared_ptr<const t_column> pkey_sptr = tbl->get_const_column("psp_pkey");
+    const t_column* pkey_col = pkey_sptr.get();
+    t_uindex nrows = tbl->size();
+
+    bool has_filters = m_config.has_filters();
+    t_mask msk;
+    if (has_filters) {
+        msk = filter_table_for_config(*tbl, m_config);
+    }
+
+    std::vector<t_tscalar> pkeys;
+    pkeys.reserve(has_filters ? msk.count() : nrows);
+    for (t_uindex idx = 0; idx < nrows; ++idx) {
+        if (!has_filters || msk.get(idx)) {
+            pkeys.push_back(m_symtable.get_interned_tscalar(pkey_col->get_scalar(idx)));
+        }
+    }
+
+    m_traversal->select_rows(m_gstate, m_config, pkeys);
 }
 
 /**
@@ -343,6 +371,11 @@ t_ctx0::sort_by(const std::vector<t_sortspec>& sortby) {
     m_traversal->sort_by(m_gstate, m_config, sortby);
 }
 
+void
+t_ctx0::set_limit(t_index limit) {
+    m_traversal->set_limit(limit);
+}
+
 void
 t_ctx0::reset_sortby() {
     m_traversal->sort_by(m_gstate, m_config, std::vector<t_sortspec>());
@@ -628,6 +661,23 @@ t_ctx0::reset_step_state() {
     m_traversal->reset_step_state();
 }
 
+bool
+t_ctx0::get_column_dependencies(std::vector<std::string>& columns) const {
+    columns = m_config.get_column_names();
+
+    for (const auto& fterm : m_config.get_fterms()) {
+        columns.push_back(fterm.m_colname);
+    }
+
+    for (const t_sortspec& sort : m_traversal->get_sort_by()) {
+        std::string colname = sort.m_colname != "" ? sort.m_colname
+                                                   : m_config.col_at(sort.m_agg_index);
+        columns.push_back(m_config.get_sort_by(colname));
+    }
+
+    return true;
+}
+
 void
 t_ctx0::disable() {
     m_features[CTX_FEAT_ENABLED] = false;
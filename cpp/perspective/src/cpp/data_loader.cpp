@@ -0,0 +1,146 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2019, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#include <perspective/first.h>
+#include <perspective/data_loader.h>
+
+namespace perspective {
+
+t_data_loader::~t_data_loader() {}
+
+void
+t_data_loader::fill_table(t_data_table& tbl, const t_schema& input_schema,
+    const std::string& index, std::uint32_t offset, std::uint32_t limit, bool is_update) {
+    bool implicit_index = false;
+    std::vector<t_loader_column> sources = get_loader_columns(input_schema);
+
+    // Adding `psp_pkey` mutates the table's columns, so the explicit index
+    // is filled first and the remaining columns, which only write into their
+    // own `t_column`, are filled afterwards.
+    std::vector<t_loader_column> fill_sources;
+    std::vector<std::shared_ptr<t_column>> fill_cols;
+
+    for (const t_loader_column& source : sources) {
+        if (source.m_name == "__INDEX__") {
+            implicit_index = true;
+            std::shared_ptr<t_column> pkey_col_sptr
+                = tbl.add_column_sptr("psp_pkey", source.m_type, true);
+            fill_column(tbl, pkey_col_sptr, "psp_pkey", source, is_update);
+            tbl.clone_column("psp_pkey", "psp_okey");
+            continue;
+        }
+
+        fill_sources.push_back(source);
+    }
+
+    for (const t_loader_column& source : fill_sources) {
+        fill_cols.push_back(tbl.get_column(source.m_name));
+    }
+
+    int num_fill = fill_sources.size();
+
+    if (is_fill_parallel()) {
+#ifdef PSP_PARALLEL_FOR
+        tbb::parallel_for(0, num_fill, 1,
+            [this, &tbl, &fill_sources, &fill_cols, is_update](int idx)
+#else
+        for (int idx = 0; idx < num_fill; ++idx)
+#endif
+            {
+                const t_loader_column& source = fill_sources[idx];
+                fill_column(tbl, fill_cols[idx], source.m_name, source, is_update);
+            }
+#ifdef PSP_PARALLEL_FOR
+        );
+#endif
+    } else {
+        for (int idx = 0; idx < num_fill; ++idx) {
+            const t_loader_column& source = fill_sources[idx];
+            fill_column(tbl, fill_cols[idx], source.m_name, source, is_update);
+        }
+    }
+
+    // Fill index column - recreated every time a `t_data_table` is created.
+    if (!implicit_index) {
+        if (index == "") {
+            // Use row number as index if not explicitly provided or provided
+            // with `__INDEX__`
+            fill_implicit_index(tbl, offset, limit);
+        } else {
+            if (!input_schema.has_column(index)) {
+                std::stringstream ss;
+                ss << "Specified index `" << index
+                   << "` is invalid as it does not appear in the Table." << std::endl;
+                PSP_COMPLAIN_AND_ABORT(ss.str());
+            }
+
+            tbl.clone_column(index, "psp_pkey");
+            tbl.clone_column(index, "psp_okey");
+        }
+    }
+}
+
+void
+t_data_loader::fill_implicit_index(
+    t_data_table& tbl, std::uint32_t offset, std::uint32_t limit) {
+    t_column* key_col = tbl.add_column("psp_pkey", DTYPE_INT32, true);
+    t_uindex nrows = tbl.size();
+
+    // Write `(ridx + offset) % limit` straight into the column, wrapping
+    // instead of taking the modulo of every row.
+    std::int32_t* keys = nrows > 0 ? key_col->get_nth<std::int32_t>(0) : nullptr;
+    std::uint32_t key = offset % limit;
+
+    for (t_uindex ridx = 0; ridx < nrows; ++ridx) {
+        keys[ridx] = static_cast<std::int32_t>(key);
+        if (++key == limit) {
+            key = 0;
+        }
+    }
+
+    key_col->valid_raw_fill();
+    tbl.clone_column("psp_pkey", "psp_okey");
+}
+
+void
+t_data_loader::fill_null(t_column& col, t_uindex ridx, bool is_update) {
+    if (is_update) {
+        col.unset(ridx);
+    } else {
+        col.clear(ridx);
+    }
+}
+
+std::shared_ptr<t_column>
+t_data_loader::promote_column(t_data_table& tbl, const std::string& name, t_dtype type,
+    std::int32_t ridx, bool fill) {
+    tbl.promote_column(name, type, ridx, fill);
+    return tbl.get_column(name);
+}
+
+std::vector<t_loader_column>
+t_data_loader::get_loader_columns(const t_schema& input_schema) const {
+    std::vector<t_loader_column> sources;
+    const std::vector<std::string>& names = input_schema.columns();
+    const std::vector<t_dtype>& types = input_schema.types();
+
+    for (std::size_t cidx = 0; cidx < names.size(); ++cidx) {
+        sources.push_back(
+            t_loader_column{names[cidx], static_cast<std::int32_t>(cidx), types[cidx]});
+    }
+
+    return sources;
+}
+
+bool
+t_data_loader::is_fill_parallel() const {
+    return false;
+}
+
+} // end namespace perspective
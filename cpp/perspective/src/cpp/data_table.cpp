@@ -279,6 +279,21 @@ t_data_table::set_size(t_uindex size) {
     m_size = size;
 }
 
+void
+t_data_table::set_size(t_uindex size, const std::vector<std::string>& colnames) {
+    PSP_TRACE_SENTINEL();
+    for (t_uindex idx = 0, loop_end = m_schema.size(); idx < loop_end; ++idx) {
+        m_columns[idx]->set_size(0);
+    }
+
+    for (const auto& colname : colnames) {
+        if (m_schema.has_column(colname)) {
+            m_columns[m_schema.get_colidx(colname)]->set_size(size);
+        }
+    }
+    m_size = size;
+}
+
 void
 t_data_table::reserve(t_uindex capacity) {
     PSP_TRACE_SENTINEL();
@@ -289,6 +304,17 @@ t_data_table::reserve(t_uindex capacity) {
     set_capacity(std::max(capacity, m_capacity));
 }
 
+void
+t_data_table::reserve(t_uindex capacity, const std::vector<std::string>& colnames) {
+    PSP_TRACE_SENTINEL();
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    for (const auto& colname : colnames) {
+        if (m_schema.has_column(colname)) {
+            m_columns[m_schema.get_colidx(colname)]->reserve(capacity);
+        }
+    }
+}
+
 t_column*
 t_data_table::_get_column(const std::string& colname) {
     PSP_TRACE_SENTINEL();
@@ -9,10 +9,15 @@
 
 #include <perspective/first.h>
 #include <iomanip>
+#include <set>
 #include <perspective/dense_tree_context.h>
 #include <perspective/dependency.h>
 #include <perspective/schema.h>
 
+#ifdef PSP_PARALLEL_FOR
+#include <tbb/parallel_for.h>
+#endif
+
 namespace perspective {
 
 t_dtree_ctx::t_dtree_ctx(std::shared_ptr<const t_data_table> strands,
@@ -22,11 +27,46 @@ t_dtree_ctx::t_dtree_ctx(std::shared_ptr<const t_data_table> strands,
     , m_strand_deltas(strand_deltas)
     , m_tree(tree)
     , m_aggspecs(aggspecs)
-    , m_init(false) {
+    , m_init(false)
+    , m_ncontext_aggspecs(aggspecs.size()) {
     std::vector<t_dep> depvec = {t_dep("psp_strand_count", DEPTYPE_COLUMN)};
 
     m_aggspecs.push_back(t_aggspec("psp_strand_count_sum", AGGTYPE_SUM, depvec));
 
+    // Sum the mean accumulators of the strand deltas, which `t_stree` applies
+    // to each node's (numerator, denominator) instead of recalculating it.
+    const t_schema& delta_schema = m_strand_deltas->get_schema();
+    for (const auto& spec : aggspecs) {
+        if (!spec.is_incremental_mean()
+            || !delta_schema.has_column(spec.get_mean_numerator_colname())) {
+            continue;
+        }
+
+        for (const auto& colname :
+            {spec.get_mean_numerator_colname(), spec.get_mean_denominator_colname()}) {
+            std::vector<t_dep> accvec = {t_dep(colname, DEPTYPE_COLUMN)};
+            m_aggspecs.push_back(t_aggspec(colname + "_sum", AGGTYPE_SUM, accvec));
+        }
+    }
+
+    // Likewise take the extremes of the values entering and leaving each node
+    // for incremental maxima and minima.
+    for (const auto& spec : aggspecs) {
+        if (!spec.is_incremental_extreme()
+            || !delta_schema.has_column(spec.get_extreme_in_colname())) {
+            continue;
+        }
+
+        t_aggtype agg
+            = spec.agg() == AGGTYPE_MAX ? AGGTYPE_HIGH_WATER_MARK : AGGTYPE_LOW_WATER_MARK;
+
+        for (const auto& colname :
+            {spec.get_extreme_in_colname(), spec.get_extreme_out_colname()}) {
+            std::vector<t_dep> accvec = {t_dep(colname, DEPTYPE_COLUMN)};
+            m_aggspecs.push_back(t_aggspec(colname + "_extreme", agg, accvec));
+        }
+    }
+
     t_uindex aggidx = 0;
     for (const auto& spec : m_aggspecs) {
         m_aggspecmap[spec.name()] = aggidx;
@@ -68,23 +108,49 @@ t_dtree_ctx::build_aggregates() {
     m_aggregates->init();
     m_aggregates->set_size(m_tree.size());
 
+    // Each aggregate reduces its own input columns into its own output
+    // column, so they are built in parallel; look the columns up first, and
+    // only build an output column once if several specs share it.
+    std::vector<std::vector<std::shared_ptr<const t_column>>> icolumns;
+    std::vector<std::shared_ptr<t_column>> ocolumns;
+    std::vector<t_uindex> specs;
+    std::set<t_column*> ovisited;
+
     for (t_uindex idx = 0, loop_end = m_aggspecs.size(); idx < loop_end; ++idx) {
         const t_aggspec& aggspec = m_aggspecs[idx];
-        const std::vector<t_dep>& deps = aggspec.get_dependencies();
+        auto output_col = m_aggregates->get_column(aggspec.name());
+        if (!ovisited.insert(output_col.get()).second) {
+            continue;
+        }
 
-        const t_data_table* tbl
-            = aggspec.is_non_delta() ? m_strands.get() : m_strand_deltas.get();
+        // The accumulators added above are always read from the deltas.
+        const t_data_table* tbl = aggspec.is_non_delta() && idx < m_ncontext_aggspecs
+            ? m_strands.get()
+            : m_strand_deltas.get();
 
-        std::vector<std::shared_ptr<const t_column>> icolumns;
-        for (const auto& d : deps) {
-            icolumns.push_back(tbl->get_const_column(d.name()));
+        std::vector<std::shared_ptr<const t_column>> spec_icolumns;
+        for (const auto& d : aggspec.get_dependencies()) {
+            spec_icolumns.push_back(tbl->get_const_column(d.name()));
         }
 
-        auto output_col = m_aggregates->get_column(aggspec.name());
-
-        t_aggregate agg(m_tree, aggspec.agg(), icolumns, output_col);
-        agg.init();
+        icolumns.push_back(spec_icolumns);
+        ocolumns.push_back(output_col);
+        specs.push_back(idx);
     }
+
+#ifdef PSP_PARALLEL_FOR
+    tbb::parallel_for(0, int(specs.size()), 1,
+        [&](int idx)
+#else
+    for (t_uindex idx = 0, loop_end = specs.size(); idx < loop_end; ++idx)
+#endif
+        {
+            t_aggregate agg(m_tree, m_aggspecs[specs[idx]].agg(), icolumns[idx], ocolumns[idx]);
+            agg.init();
+        }
+#ifdef PSP_PARALLEL_FOR
+    );
+#endif
 }
 
 const t_data_table&
@@ -9,6 +9,7 @@
 
 #include <perspective/emscripten.h>
 #include <perspective/arrow_loader.h>
+#include <perspective/data_loader.h>
 #include <perspective/arrow_writer.h>
 #include <arrow/csv/api.h>
 
@@ -265,19 +266,38 @@ namespace binding {
             std::uint32_t dsize = dictvec["length"].as<std::uint32_t>();
 
             t_vocab* vocab = col->_get_vocab();
-            std::string elem;
+            std::vector<const char*> strs(dsize);
+            std::vector<std::uint32_t> lengths(dsize);
+            std::vector<t_uindex> interned(dsize);
 
             for (std::uint32_t i = 0; i < dsize; ++i) {
-                std::int32_t bidx = offsets[i];
-                std::size_t es = offsets[i + 1] - bidx;
-                elem.assign(reinterpret_cast<char*>(data.data()) + bidx, es);
-#ifdef PSP_DEBUG
-                // Make sure there are no duplicates in the arrow dictionary
-                t_uindex idx = vocab->get_interned(elem);
-                assert(idx == i);
-#else
-                vocab->get_interned(elem);
-#endif
+                strs[i] = reinterpret_cast<const char*>(data.data()) + offsets[i];
+                lengths[i] = offsets[i + 1] - offsets[i];
+            }
+
+            vocab->intern_many(strs.data(), lengths.data(), dsize, interned.data());
+
+            // The column holds the arrow dictionary's indices, which are only
+            // the interned ids when the vocab was empty and the dictionary has
+            // no duplicates - otherwise rewrite each index through the remap,
+            // as `ArrowLoader` does.
+            bool is_identity = true;
+            for (std::uint32_t i = 0; i < dsize; ++i) {
+                if (interned[i] != i) {
+                    is_identity = false;
+                    break;
+                }
+            }
+
+            t_uindex nrows = col->size();
+            if (is_identity || nrows == 0) {
+                return;
+            }
+
+            t_uindex* out = col->get_nth<t_uindex>(0);
+            for (t_uindex ridx = 0; ridx < nrows; ++ridx) {
+                t_uindex didx = out[ridx];
+                out[ridx] = didx < dsize ? interned[didx] : 0;
             }
         }
     } // namespace arraybuffer
@@ -718,21 +738,15 @@ namespace binding {
                 continue;
 
             if (item.isNull()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                t_data_loader::fill_null(*col, i, is_update);
                 continue;
             }
 
             int64_t out;
             if (val_to_datetime(item, &out)) {
                 col->set_nth(i, out);
-            } else if (is_update) {
-                col->unset(i);
             } else {
-                col->clear(i);
+                t_data_loader::fill_null(*col, i, is_update);
             }
         }
     }
@@ -748,21 +762,15 @@ namespace binding {
                 continue;
 
             if (item.isNull()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                t_data_loader::fill_null(*col, i, is_update);
                 continue;
             }
 
             t_date out;
             if (val_to_date(item, &out)) {
                 col->set_nth(i, out);
-            } else if (is_update) {
-                col->unset(i);
             } else {
-                col->clear(i);
+                t_data_loader::fill_null(*col, i, is_update);
             }
         }
     }
@@ -778,11 +786,7 @@ namespace binding {
                 continue;
 
             if (item.isNull()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                t_data_loader::fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -802,11 +806,7 @@ namespace binding {
                 continue;
 
             if (item.isNull()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                t_data_loader::fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -825,11 +825,7 @@ namespace binding {
                 continue;
 
             if (item.isNull()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                t_data_loader::fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -838,8 +834,7 @@ namespace binding {
                 std::cout << "Promoting column `" 
                     << name << "` from int64 to string because `" 
                     << fval << "` is nan" << std::endl;
-                tbl.promote_column(name, DTYPE_STR, i, false);
-                col = tbl.get_column(name);
+                col = t_data_loader::promote_column(tbl, name, DTYPE_STR, i, false);
                 _fill_col_string(
                     accessor, col, name, cidx, DTYPE_STR, is_update);
                 return;
@@ -861,11 +856,7 @@ namespace binding {
                 continue;
 
             if (item.isNull()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                t_data_loader::fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -883,16 +874,14 @@ namespace binding {
                     double fval = item.as<double>();
                     if (!is_update && (fval > 2147483647 || fval < -2147483648)) {
                         std::cout << "Promoting to float" << std::endl;
-                        tbl.promote_column(name, DTYPE_FLOAT64, i, true);
-                        col = tbl.get_column(name);
+                        col = t_data_loader::promote_column(tbl, name, DTYPE_FLOAT64, i, true);
                         type = DTYPE_FLOAT64;
                         col->set_nth(i, fval);
                     } else if (!is_update && isnan(fval)) {
                         std::cout << "Promoting column `" 
                             << name << "` from int32 to string because `" 
                             << fval << "` is nan" << std::endl;
-                        tbl.promote_column(name, DTYPE_STR, i, false);
-                        col = tbl.get_column(name);
+                        col = t_data_loader::promote_column(tbl, name, DTYPE_STR, i, false);
                         _fill_col_string(
                             accessor, col, name, cidx, DTYPE_STR, is_update);
                         return;
@@ -1012,44 +1001,31 @@ namespace binding {
         }
     }
 
-    void
-    _fill_data(t_data_table& tbl, t_data_accessor dcol, const t_schema& input_schema, const std::string& index, std::uint32_t offset, std::uint32_t limit, bool is_update) {
-        bool implicit_index = false;
-        std::vector<std::string> col_names(input_schema.columns());
-        std::vector<t_dtype> data_types(input_schema.types());
-
-        for (auto cidx = 0; cidx < col_names.size(); ++cidx) {
-            auto name = col_names[cidx];
-            auto type = data_types[cidx];
-
-            if (name == "__INDEX__") {
-                implicit_index = true;
-                std::shared_ptr<t_column> pkey_col_sptr = tbl.add_column_sptr("psp_pkey", type, true);
-                _fill_data_helper(dcol, tbl, pkey_col_sptr, "psp_pkey", cidx, type, is_update);
-                tbl.clone_column("psp_pkey", "psp_okey");
-                continue;
-            }
+    /**
+     * @brief Fills a `t_data_table` from a Javascript data accessor, one
+     * `_fill_data_helper` call per column.
+     */
+    class t_accessor_loader : public t_data_loader {
+    public:
+        t_accessor_loader(t_data_accessor accessor)
+            : m_accessor(accessor) {}
 
-            auto col = tbl.get_column(name);
-            _fill_data_helper(dcol, tbl, col, name, cidx, type, is_update);
+    protected:
+        void
+        fill_column(t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name,
+            const t_loader_column& source, bool is_update) override {
+            _fill_data_helper(m_accessor, tbl, col, name, source.m_cidx, source.m_type, is_update);
         }
 
-        // Fill index column - recreated every time a `t_data_table` is created.
-        if (!implicit_index) {
-            if (index == "") {
-                // Use row number as index if not explicitly provided or provided with `__INDEX__`
-                auto key_col = tbl.add_column("psp_pkey", DTYPE_INT32, true);
-                auto okey_col = tbl.add_column("psp_okey", DTYPE_INT32, true);
+    private:
+        t_data_accessor m_accessor;
+    };
 
-                for (std::uint32_t ridx = 0; ridx < tbl.size(); ++ridx) {
-                    key_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
-                    okey_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
-                }
-            } else {
-                tbl.clone_column(index, "psp_pkey");
-                tbl.clone_column(index, "psp_okey");
-            }
-        }
+    void
+    _fill_data(t_data_table& tbl, t_data_accessor dcol, const t_schema& input_schema,
+        const std::string& index, std::uint32_t offset, std::uint32_t limit, bool is_update) {
+        t_accessor_loader loader(dcol);
+        loader.fill_table(tbl, input_schema, index, offset, limit, is_update);
     }
 
     /******************************************************************************
@@ -1098,51 +1074,7 @@ namespace binding {
                 auto map = std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>();
                 if (is_update) {
                     auto gnode_output_schema = gnode->get_output_schema();
-                    auto schema = gnode_output_schema.drop({"psp_okey"});
-                    auto column_names = schema.columns();
-                    auto data_types = schema.types();
-                    
-                    for (auto idx = 0; idx < column_names.size(); ++idx) {
-                        const std::string& name = column_names[idx];
-                        const t_dtype& type = data_types[idx];
-                        switch (type) {
-                            case DTYPE_FLOAT32:
-                                map[name] = std::make_shared<arrow::FloatType>();
-                                break;
-                            case DTYPE_FLOAT64:
-                                map[name] = std::make_shared<arrow::DoubleType>();
-                                break;
-                            case DTYPE_STR:
-                                map[name] = std::make_shared<arrow::StringType>();
-                                break;
-                            case DTYPE_BOOL:
-                                map[name] = std::make_shared<arrow::BooleanType>();
-                                break;
-                            case DTYPE_UINT32:
-                                map[name] = std::make_shared<arrow::UInt32Type>();
-                                break;
-                            case DTYPE_UINT64:
-                                map[name] = std::make_shared<arrow::UInt64Type>();
-                                break;                  
-                            case DTYPE_INT32:
-                                map[name] = std::make_shared<arrow::Int32Type>();
-                                break;
-                            case DTYPE_INT64:
-                                map[name] = std::make_shared<arrow::Int64Type>();
-                                break;
-                            case DTYPE_TIME:
-                                map[name] = std::make_shared<arrow::TimestampType>();
-                                break;                       
-                            case DTYPE_DATE:
-                                map[name] = std::make_shared<arrow::Date64Type>();
-                                break;
-                            default:
-                                std::stringstream ss;
-                                ss << "Error loading arrow type " << dtype_to_str(type) << " for column " << name << std::endl;
-                                PSP_COMPLAIN_AND_ABORT(ss.str())
-                                break;
-                        }
-                    }
+                    map = apachearrow::get_csv_column_types(gnode_output_schema.drop({"psp_okey"}));
                 }
                 arrow_loader.init_csv(s, is_update, map);
             } else {
@@ -1509,6 +1441,10 @@ namespace binding {
             view_config->set_column_pivot_depth(config["column_pivot_depth"].as<std::int32_t>());
         }
 
+        if (has_value(config["limit"])) {
+            view_config->set_limit(config["limit"].as<std::int32_t>());
+        }
+
         return view_config;
     }
 
@@ -1568,6 +1504,7 @@ namespace binding {
         auto cfg = t_config(columns, fterm, filter_op, computed_columns);
         auto ctx0 = std::make_shared<t_ctx0>(*(schema.get()), cfg);
         ctx0->init();
+        ctx0->set_limit(view_config->get_limit());
         ctx0->sort_by(sortspec);
 
         auto pool = table->get_pool();
@@ -1749,6 +1686,23 @@ namespace binding {
         return arr;
     }
 
+    /******************************************************************************
+     *
+     * Expiry
+     */
+
+    // Embind cannot pass 64-bit integers to and from Javascript numbers, so
+    // windows and deadlines in milliseconds cross the binding as doubles.
+    void
+    set_table_expiry(std::shared_ptr<Table> table, const std::string& colname, double window) {
+        table->set_expiry(colname, static_cast<std::int64_t>(window));
+    }
+
+    double
+    get_pool_expiry_deadline(std::shared_ptr<t_pool> pool) {
+        return static_cast<double>(pool->get_expiry_deadline());
+    }
+
 } // end namespace binding
 } // end namespace perspective
 
@@ -2241,4 +2195,6 @@ EMSCRIPTEN_BINDINGS(perspective) {
     function("get_table_computed_schema", &get_table_computed_schema<t_val>);
     function("get_computation_input_types", &get_computation_input_types);
     function("is_valid_datetime", &is_valid_datetime);
+    function("set_table_expiry", &set_table_expiry);
+    function("get_pool_expiry_deadline", &get_pool_expiry_deadline);
 }
@@ -13,15 +13,37 @@
 #include <perspective/flat_traversal.h>
 #include <perspective/scalar.h>
 #include <perspective/schema.h>
+#include <numeric>
 #ifdef PSP_PARALLEL_FOR
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
 #endif
 
 namespace perspective {
 
+namespace {
+
+// Sort the first `nkeep` elements of `elems` into place and drop the rest.
+void
+partial_sort_elems(
+    std::vector<t_mselem>& elems, t_index nkeep, const std::vector<t_sorttype>& sort_order) {
+    t_multisorter sorter(sort_order);
+    if (nkeep < static_cast<t_index>(elems.size())) {
+        std::partial_sort(elems.begin(), elems.begin() + nkeep, elems.end(), sorter);
+        elems.erase(elems.begin() + nkeep, elems.end());
+    } else {
+        std::sort(elems.begin(), elems.end(), sorter);
+    }
+}
+
+} // namespace
+
 t_ftrav::t_ftrav()
     : m_step_deletes(0)
-    , m_step_inserts(0) {
+    , m_step_inserts(0)
+    , m_limit(-1)
+    , m_truncated(false)
+    , m_needs_rescan(false) {
     m_index = std::make_shared<std::vector<t_mselem>>();
 }
 
@@ -65,8 +87,7 @@ t_ftrav::get_pkeys(const std::vector<std::pair<t_uindex, t_uindex>>& cells) cons
 
 std::vector<t_tscalar>
 t_ftrav::get_pkeys(t_index begin_row, t_index end_row) const {
-    t_index index_size = m_index->size();
-    end_row = std::min(end_row, index_size);
+    end_row = std::min(end_row, size());
     std::vector<t_tscalar> rval(end_row - begin_row);
     for (t_index ridx = begin_row; ridx < end_row; ++ridx) {
         rval[ridx - begin_row] = (*m_index)[ridx].m_pkey;
@@ -139,19 +160,131 @@ t_ftrav::sort_by(std::shared_ptr<const t_gstate> gstate, const t_config& config,
     const std::vector<t_sortspec>& sortby) {
     if (sortby.empty())
         return;
-    t_multisorter sorter(get_sort_orders(sortby));
-    t_index size = m_index->size();
-    auto sort_elems = std::make_shared<std::vector<t_mselem>>(static_cast<size_t>(size));
     m_sortby = sortby;
 
+    // Include the reserve of a bounded traversal, see `get_capacity`.
+    std::vector<t_tscalar> pkeys;
+    pkeys.reserve(m_index->size());
+    for (const auto& elem : *m_index) {
+        pkeys.push_back(elem.m_pkey);
+    }
+
+    select_rows(gstate, config, pkeys);
+}
+
+void
+t_ftrav::select_rows(std::shared_ptr<const t_gstate> gstate, const t_config& config,
+    const std::vector<t_tscalar>& pkeys) {
+    const std::vector<t_sortspec>& sortby = m_sortby;
+    std::vector<t_sorttype> sort_order = get_sort_orders(sortby);
+    t_index size = pkeys.size();
+    auto sort_elems = std::make_shared<std::vector<t_mselem>>(static_cast<size_t>(size));
+
+    // A bounded traversal only needs its first `get_capacity()` rows in
+    // order.
+    bool bounded = is_bounded() && size > get_capacity();
+    t_index nkeep = bounded ? get_capacity() : size;
+
+    // Resolve each sort column once, and the row of each pkey once, rather
+    // than for every cell.
+    std::shared_ptr<const t_data_table> table = gstate->get_table();
+    t_uindex ncols = sortby.size();
+    std::vector<const t_column*> sort_cols(ncols);
+    bool encodable = true;
+
+    for (t_uindex cidx = 0; cidx < ncols; ++cidx) {
+        const t_sortspec& sort = sortby[cidx];
+        std::string colname;
+        if (sort.m_colname != "") {
+            colname = config.get_sort_by(sort.m_colname);
+        } else {
+            colname = config.col_at(sort.m_agg_index);
+        }
+
+        sort_cols[cidx] = table->get_const_column(config.get_sort_by(colname)).get();
+        encodable = encodable && t_sort_keys::is_encodable(sort_cols[cidx]->get_dtype());
+    }
+
+    std::vector<t_uindex> ridxs(size);
+    bool rows_exist = true;
+
     for (t_index idx = 0; idx < size; ++idx) {
-        t_mselem& elem = (*sort_elems)[idx];
-        t_tscalar pkey = (*m_index)[idx].m_pkey;
-        fill_sort_elem(gstate, config, pkey, elem);
+        t_rlookup lookup = gstate->lookup(pkeys[idx]);
+        rows_exist = rows_exist && lookup.m_exists;
+        ridxs[idx] = lookup.m_idx;
+    }
+
+    if (!rows_exist) {
+        for (t_index idx = 0; idx < size; ++idx) {
+            t_mselem& elem = (*sort_elems)[idx];
+            fill_sort_elem(gstate, config, pkeys[idx], elem);
+        }
+
+        partial_sort_elems(*sort_elems, nkeep, sort_order);
+        std::swap(m_index, sort_elems);
+    } else {
+#ifdef PSP_PARALLEL_FOR
+        tbb::parallel_for(0, int(size), 1,
+            [&](int idx)
+#else
+        for (t_index idx = 0; idx < size; ++idx)
+#endif
+            {
+                t_mselem& elem = (*sort_elems)[idx];
+                elem.m_pkey = pkeys[idx];
+                elem.m_row.resize(ncols);
+                for (t_uindex cidx = 0; cidx < ncols; ++cidx) {
+                    elem.m_row[cidx] = sort_cols[cidx]->get_scalar(ridxs[idx]);
+                }
+            }
+#ifdef PSP_PARALLEL_FOR
+        );
+#endif
+
+        // The symtable is not thread safe, so strings are interned after.
+        for (t_uindex cidx = 0; cidx < ncols; ++cidx) {
+            if (sort_cols[cidx]->get_dtype() != DTYPE_STR)
+                continue;
+
+            for (auto& elem : *sort_elems) {
+                elem.m_row[cidx] = m_symtable.get_interned_tscalar(elem.m_row[cidx]);
+            }
+        }
+
+        if (encodable) {
+            t_sort_keys keys(size, sort_order);
+            for (t_uindex cidx = 0; cidx < ncols; ++cidx) {
+                keys.encode_column(cidx, *sort_cols[cidx], ridxs);
+            }
+
+            std::vector<t_uindex> order(size);
+            std::iota(order.begin(), order.end(), 0);
+            if (bounded) {
+                std::partial_sort(order.begin(), order.begin() + nkeep, order.end(),
+                    t_sort_key_sorter(keys, *sort_elems));
+            } else {
+                PSP_PSORT(order.begin(), order.end(), t_sort_key_sorter(keys, *sort_elems));
+            }
+
+            auto sorted = std::make_shared<std::vector<t_mselem>>();
+            sorted->reserve(nkeep);
+            for (t_index idx = 0; idx < nkeep; ++idx) {
+                sorted->push_back(std::move((*sort_elems)[order[idx]]));
+            }
+
+            std::swap(m_index, sorted);
+        } else {
+            partial_sort_elems(*sort_elems, nkeep, sort_order);
+            std::swap(m_index, sort_elems);
+        }
+    }
+
+    m_truncated = bounded;
+    m_needs_rescan = false;
+    if (m_truncated && !m_index->empty()) {
+        m_cutoff = m_index->back();
     }
 
-    std::swap(m_index, sort_elems);
-    std::sort(m_index->begin(), m_index->end(), sorter);
     m_pkeyidx.clear();
     for (t_index idx = 0, loop_end = m_index->size(); idx < loop_end; ++idx) {
         m_pkeyidx[(*m_index)[idx].m_pkey] = idx;
@@ -160,7 +293,8 @@ t_ftrav::sort_by(std::shared_ptr<const t_gstate> gstate, const t_config& config,
 
 t_index
 t_ftrav::size() const {
-    return m_index->size();
+    t_index index_size = m_index->size();
+    return is_bounded() ? std::min(index_size, m_limit) : index_size;
 }
 
 void
@@ -207,6 +341,8 @@ void
 t_ftrav::reset() {
     if (m_index.get())
         m_index->clear();
+    m_truncated = false;
+    m_needs_rescan = false;
 }
 
 void
@@ -243,8 +379,14 @@ t_ftrav::step_begin() {
 
 void
 t_ftrav::step_end() {
+    bool bounded = is_bounded();
+    t_index capacity = get_capacity();
+
     // The new number of rows in this traversal
     t_index new_size = m_index->size() + m_step_inserts - m_step_deletes;
+    if (bounded) {
+        new_size = std::min(new_size, capacity);
+    }
 
     auto new_index = std::make_shared<std::vector<t_mselem>>();
     new_index->reserve(new_size);
@@ -262,11 +404,28 @@ t_ftrav::step_end() {
         new_rows.push_back(pkelem_iter->second);
     }
 
-    // TODO: int/float/date/datetime pkeys are already sorted here, so if
-    // there was a way to assert that `psp_pkey` is a string typed column,
-    // we can conditional the sort on whether m_sortby.size() > 0 or if
-    // psp_pkey is a string column.
-    std::sort(new_rows.begin(), new_rows.end(), sorter);
+    bool dropped = bounded && static_cast<t_index>(new_rows.size()) > capacity;
+
+    // Every row dropped from a bounded traversal sorts after the first one.
+    t_mselem first_dropped;
+
+    if (dropped) {
+        // Only the first `capacity` new rows can be kept, so the rest are
+        // never sorted.
+        std::nth_element(new_rows.begin(), new_rows.begin() + capacity, new_rows.end(), sorter);
+        first_dropped = new_rows[capacity];
+        std::sort(new_rows.begin(), new_rows.begin() + capacity, sorter);
+        for (auto it = new_rows.begin() + capacity; it != new_rows.end(); ++it) {
+            m_pkeyidx.erase(it->m_pkey);
+        }
+        new_rows.erase(new_rows.begin() + capacity, new_rows.end());
+    } else {
+        // TODO: int/float/date/datetime pkeys are already sorted here, so if
+        // there was a way to assert that `psp_pkey` is a string typed column,
+        // we can conditional the sort on whether m_sortby.size() > 0 or if
+        // psp_pkey is a string column.
+        std::sort(new_rows.begin(), new_rows.end(), sorter);
+    }
 
     for (auto it = new_rows.begin(); it != new_rows.end(); ++it) {
         const t_mselem& new_elem = *it;
@@ -305,6 +464,38 @@ t_ftrav::step_end() {
         }
     }
 
+    if (bounded) {
+        if (static_cast<t_index>(new_index->size()) > capacity) {
+            const t_mselem& first = (*new_index)[capacity];
+            if (!dropped || sorter(first, first_dropped)) {
+                first_dropped = first;
+            }
+
+            for (auto it = new_index->begin() + capacity; it != new_index->end(); ++it) {
+                m_pkeyidx.erase(it->m_pkey);
+            }
+            new_index->erase(new_index->begin() + capacity, new_index->end());
+            dropped = true;
+        }
+
+        // Rows left out of the index sort after `m_cutoff`, so the first
+        // `m_limit` rows are still the top of the context as long as the
+        // last of them does not sort after the cutoff. Deletes and updates
+        // are absorbed by the reserve until it runs out, and only then is
+        // the context rescanned.
+        if (dropped && (!m_truncated || sorter(first_dropped, m_cutoff))) {
+            m_cutoff = first_dropped;
+        }
+
+        m_truncated = m_truncated || dropped;
+
+        if (m_truncated && m_limit > 0) {
+            t_index nrows = new_index->size();
+            m_needs_rescan
+                = nrows < m_limit || sorter(m_cutoff, (*new_index)[m_limit - 1]);
+        }
+    }
+
     std::swap(new_index, m_index);
     m_new_elems.clear();
 }
@@ -354,6 +545,31 @@ t_ftrav::empty_sort_by() const {
     return m_sortby.empty();
 }
 
+void
+t_ftrav::set_limit(t_index limit) {
+    m_limit = limit;
+}
+
+t_index
+t_ftrav::get_limit() const {
+    return m_limit;
+}
+
+bool
+t_ftrav::is_bounded() const {
+    return m_limit >= 0 && !m_sortby.empty();
+}
+
+t_index
+t_ftrav::get_capacity() const {
+    return 2 * m_limit;
+}
+
+bool
+t_ftrav::needs_rescan() const {
+    return m_needs_rescan;
+}
+
 void
 t_ftrav::reset_step_state() {
     m_step_deletes = 0;
@@ -369,7 +585,8 @@ t_ftrav::lower_bound_row_idx(std::shared_ptr<const t_gstate> gstate, const t_con
 
     fill_sort_elem(gstate, config, row, target_val);
 
-    auto iter = std::lower_bound(m_index->begin(), m_index->end(), target_val, sorter);
+    auto end = m_index->begin() + size();
+    auto iter = std::lower_bound(m_index->begin(), end, target_val, sorter);
 
     return std::distance(m_index->begin(), iter);
 }
@@ -377,7 +594,7 @@ t_ftrav::lower_bound_row_idx(std::shared_ptr<const t_gstate> gstate, const t_con
 t_index
 t_ftrav::get_row_idx(t_tscalar pkey) const {
     auto pkiter = m_pkeyidx.find(pkey);
-    if (pkiter == m_pkeyidx.end())
+    if (pkiter == m_pkeyidx.end() || static_cast<t_index>(pkiter->second) >= size())
         return -1;
     return pkiter->second;
 }
@@ -52,7 +52,8 @@ t_gnode::t_gnode(const t_schema& input_schema, const t_schema& output_schema)
     , m_init(false)
     , m_id(0)
     , m_last_input_port_id(0)
-    , m_pool_cleanup([]() {}) {
+    , m_pool_cleanup([]() {})
+    , m_expiry_window(0) {
     PSP_TRACE_SENTINEL();
     LOG_CONSTRUCTOR("t_gnode");
 
@@ -247,6 +248,8 @@ t_gnode::_process_table(t_uindex port_id) {
 
     t_process_table_result result;
     result.m_flattened_data_table = nullptr;
+    result.m_is_append = false;
+    result.m_rows_added_or_removed = false;
     result.m_should_notify_userspace = false;
 
     std::shared_ptr<t_data_table> flattened = nullptr;
@@ -272,11 +275,25 @@ t_gnode::_process_table(t_uindex port_id) {
 
     std::vector<t_rlookup> row_lookup(flattened_num_rows);
     t_column* pkey_col = flattened->get_column("psp_pkey").get();
-    
+    t_column* op_col = flattened->get_column("psp_op").get();
+
+    // Whether every row inserts a primary key that is not in the dataset
+    // yet, in which case there is no previous state to diff against.
+    bool all_new = true;
+    t_tscalar prev_pkey;
+    prev_pkey.clear();
+
     for (t_uindex idx = 0; idx < flattened_num_rows; ++idx) {
         // See if each primary key in flattened already exist in the dataset
         t_tscalar pkey = pkey_col->get_scalar(idx);
         row_lookup[idx] = m_gstate->lookup(pkey);
+
+        std::uint8_t op = *(op_col->get_nth<std::uint8_t>(idx));
+        bool exists = row_lookup[idx].m_exists;
+        all_new = all_new && !exists && op == OP_INSERT && pkey != prev_pkey;
+        result.m_rows_added_or_removed = result.m_rows_added_or_removed
+            || (op == OP_INSERT && !exists) || (op == OP_DELETE && exists);
+        prev_pkey = pkey;
     }
 
     // first update - master table is empty
@@ -287,6 +304,7 @@ t_gnode::_process_table(t_uindex port_id) {
         _compute_all_columns({flattened});
 
         m_gstate->update_master_table(flattened.get());
+        _track_expiry(*flattened);
 
         m_oports[PSP_PORT_FLATTENED]->set_table(flattened);
 
@@ -308,6 +326,28 @@ t_gnode::_process_table(t_uindex port_id) {
 
     input_port->release_or_clear();
 
+    // Append a batch of new rows without building the delta, prev, current,
+    // transitions and existed tables - contexts add the rows from
+    // `flattened` alone, as they do on the first update.
+    if (all_new) {
+        _compute_all_columns({flattened});
+
+        m_gstate->update_master_table(flattened.get());
+        _track_expiry(*flattened);
+
+        m_oports[PSP_PORT_FLATTENED]->set_table(flattened);
+
+    #ifdef PSP_GNODE_VERIFY
+        auto state_table = get_table();
+        PSP_GNODE_VERIFY_TABLE(state_table);
+    #endif
+
+        result.m_flattened_data_table = flattened;
+        result.m_is_append = true;
+        result.m_should_notify_userspace = true;
+        return result;
+    }
+
     // Use `t_process_state` to manage intermediate structures
     t_process_state _process_state;
 
@@ -333,16 +373,23 @@ t_gnode::_process_table(t_uindex port_id) {
         _process_state.m_flattened_data_table,
         _process_state.m_lookup);
 
+    result.m_changed_columns = _get_changed_columns(*flattened, row_lookup);
+
     // Clear delta, prev, current, transitions, existed on EACH call.
     _process_state.clear_transitional_data_tables();
 
+    // Only the columns read by a context are written to the transitional
+    // tables - the rest are left empty.
+    _process_state.m_column_names = _get_transitional_column_names();
+
     // compute values on transitional tables before reserve
-    _compute_all_columns(
+    _compute_columns(
         {
             _process_state.m_delta_data_table,
             _process_state.m_prev_data_table,
             _process_state.m_current_data_table
-        });
+        },
+        _process_state.m_column_names);
 
     // And re-reserved for the amount of data in `flattened`
     _process_state.reserve_transitional_data_tables(flattened_num_rows);
@@ -353,23 +400,7 @@ t_gnode::_process_table(t_uindex port_id) {
     // mask_count = flattened_num_rows - number of rows that were removed
     _process_state.set_size_transitional_data_tables(mask_count);
 
-    // Reconcile column names - only attempt to process valid computed columns
-    std::vector<std::string> column_names = get_output_schema().m_columns;
-    std::vector<std::string> valid_computed_columns;
-    valid_computed_columns.reserve(
-        m_computed_column_map.m_computed_columns.size());
-
-    for (const auto& computed : m_computed_column_map.m_computed_columns) {
-        valid_computed_columns.push_back(computed.first);
-    }
-    
-    // Process the `real` columns of the gnode state output schema + the
-    // computed columns registered by each context.
-    column_names.insert(
-        column_names.end(),
-        valid_computed_columns.begin(),
-        valid_computed_columns.end());
-
+    const std::vector<std::string>& column_names = _process_state.m_column_names;
     t_uindex ncols = column_names.size();
 
 #ifdef PSP_PARALLEL_FOR
@@ -442,12 +473,13 @@ t_gnode::_process_table(t_uindex port_id) {
     );
 #endif
     // After transitional tables are written, compute their values
-    _compute_all_columns(
+    _compute_columns(
         {
             _process_state.m_delta_data_table,
             _process_state.m_prev_data_table,
             _process_state.m_current_data_table
-        });
+        },
+        _process_state.m_column_names);
 
     /**
      * After all columns have been processed (transitional tables written into),
@@ -478,6 +510,7 @@ t_gnode::_process_table(t_uindex port_id) {
     #endif
 
     m_gstate->update_master_table(flattened_masked.get());
+    _track_expiry(*flattened_masked);
 
     #ifdef PSP_GNODE_VERIFY
     {
@@ -606,7 +639,7 @@ t_gnode::process(t_uindex port_id) {
     t_process_table_result result = _process_table(port_id);
 
     if (result.m_flattened_data_table) {
-        notify_contexts(*result.m_flattened_data_table);
+        notify_contexts(result);
     }
 
     // Whether the user should be notified - False if process_table exited
@@ -619,6 +652,22 @@ t_gnode::mapping_size() const {
     return m_gstate->mapping_size();
 }
 
+t_uindex
+t_gnode::compact_vocabularies() {
+    PSP_VERBOSE_ASSERT(m_init, "Cannot `compact_vocabularies` on an uninited gnode.");
+    return m_gstate->compact_vocabularies();
+}
+
+t_uindex
+t_gnode::get_vocab_size(const std::string& colname) const {
+    PSP_VERBOSE_ASSERT(m_init, "Cannot `get_vocab_size` on an uninited gnode.");
+    auto column = get_table()->get_const_column(colname);
+    if (column->get_dtype() != DTYPE_STR) {
+        PSP_COMPLAIN_AND_ABORT("Column `" + colname + "` is not a string column.");
+    }
+    return column->get_vlenidx();
+}
+
 t_data_table*
 t_gnode::_get_otable(t_uindex port_id) {
     PSP_TRACE_SENTINEL();
@@ -927,7 +976,7 @@ t_gnode::_unregister_context(const std::string& name) {
 }
 
 void
-t_gnode::notify_contexts(const t_data_table& flattened) {
+t_gnode::notify_contexts(const t_process_table_result& result) {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
     
@@ -941,23 +990,23 @@ t_gnode::notify_contexts(const t_data_table& flattened) {
         ctxh_count++;
     }
 
-    auto notify_context_helper = [this, &ctxhvec, &flattened](t_index ctxidx) {
+    auto notify_context_helper = [this, &ctxhvec, &result](t_index ctxidx) {
         const t_ctx_handle& ctxh = ctxhvec[ctxidx];
         switch (ctxh.get_type()) {
             case TWO_SIDED_CONTEXT: {
-                notify_context<t_ctx2>(flattened, ctxh);
+                notify_context<t_ctx2>(result, ctxh);
             } break;
             case ONE_SIDED_CONTEXT: {
-                notify_context<t_ctx1>(flattened, ctxh);
+                notify_context<t_ctx1>(result, ctxh);
             } break;
             case ZERO_SIDED_CONTEXT: {
-                notify_context<t_ctx0>(flattened, ctxh);
+                notify_context<t_ctx0>(result, ctxh);
             } break;
             case UNIT_CONTEXT: {
-                notify_context<t_ctxunit>(flattened, ctxh);
+                notify_context<t_ctxunit>(result, ctxh);
             } break;
             case GROUPED_PKEY_CONTEXT: {
-                notify_context<t_ctx_grouped_pkey>(flattened, ctxh);
+                notify_context<t_ctx_grouped_pkey>(result, ctxh);
             } break;
             default: { PSP_COMPLAIN_AND_ABORT("Unexpected context type"); } break;
         }
@@ -1004,6 +1053,150 @@ t_gnode::_compute_all_columns(
     }
 }
 
+void
+t_gnode::_compute_columns(
+    std::vector<std::shared_ptr<t_data_table>> tables,
+    const std::vector<std::string>& column_names) {
+    std::set<std::string> names(column_names.begin(), column_names.end());
+    const auto& computed_columns = m_computed_column_map.m_computed_columns;
+    for (std::shared_ptr<t_data_table> table : tables) {
+        for (const auto& computed : computed_columns) {
+            if (names.find(computed.first) != names.end()) {
+                _compute_column(computed.second, table);
+            }
+        }
+    }
+}
+
+std::vector<std::string>
+t_gnode::_get_transitional_column_names() const {
+    std::set<std::string> used;
+
+    // Tree contexts read all of their columns from the transitional tables,
+    // and flat contexts only their filter columns.
+    for (const auto& kv : m_contexts) {
+        const t_ctx_handle& ctxh = kv.second;
+        std::vector<std::string> columns;
+        switch (ctxh.get_type()) {
+            case TWO_SIDED_CONTEXT: {
+                ctxh.get<t_ctx2>()->get_column_dependencies(columns);
+            } break;
+            case ONE_SIDED_CONTEXT: {
+                ctxh.get<t_ctx1>()->get_column_dependencies(columns);
+            } break;
+            case ZERO_SIDED_CONTEXT: {
+                for (const auto& fterm : ctxh.get<t_ctx0>()->get_config().get_fterms()) {
+                    columns.push_back(fterm.m_colname);
+                }
+            } break;
+            default: break;
+        }
+
+        used.insert(columns.begin(), columns.end());
+    }
+
+    // Computed columns are computed on the transitional tables, so they
+    // need their inputs as well.
+    const auto& computed_columns = m_computed_column_map.m_computed_columns;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto& computed : computed_columns) {
+            if (used.find(computed.first) == used.end()) {
+                continue;
+            }
+
+            for (const auto& input : std::get<2>(computed.second)) {
+                changed = used.insert(input).second || changed;
+            }
+        }
+    }
+
+    // Process the `real` columns of the gnode state output schema + the
+    // computed columns registered by each context. Object columns are always
+    // processed, as that is where their reference counts are released.
+    std::vector<std::string> rval;
+    for (t_uindex idx = 0, loop_end = m_output_schema.size(); idx < loop_end; ++idx) {
+        const std::string& cname = m_output_schema.m_columns[idx];
+        if (used.find(cname) != used.end() || m_output_schema.m_types[idx] == DTYPE_OBJECT) {
+            rval.push_back(cname);
+        }
+    }
+
+    for (const auto& computed : computed_columns) {
+        if (used.find(computed.first) != used.end()) {
+            rval.push_back(computed.first);
+        }
+    }
+
+    return rval;
+}
+
+std::set<std::string>
+t_gnode::_get_changed_columns(
+    const t_data_table& flattened, const std::vector<t_rlookup>& lookup) const {
+    const t_column* op_col = flattened.get_const_column("psp_op").get();
+    const std::vector<std::string>& column_names = m_output_schema.m_columns;
+    t_uindex ncols = column_names.size();
+    t_uindex nrows = flattened.size();
+    std::vector<std::uint8_t> changed(ncols, 0);
+
+#ifdef PSP_PARALLEL_FOR
+    tbb::parallel_for(0, int(ncols), 1,
+        [&](int colidx)
+#else
+    for (t_uindex colidx = 0; colidx < ncols; ++colidx)
+#endif
+        {
+            auto column = flattened.get_const_column_safe(column_names[colidx]);
+            if (column && !column->is_status_enabled()) {
+                changed[colidx] = 1;
+            } else if (column) {
+                // Unset cells of a partial update are neither valid nor
+                // cleared.
+                for (t_uindex idx = 0; idx < nrows; ++idx) {
+                    std::uint8_t op = *(op_col->get_nth<std::uint8_t>(idx));
+                    if (op == OP_INSERT && lookup[idx].m_exists
+                        && (column->is_valid(idx) || column->is_cleared(idx))) {
+                        changed[colidx] = 1;
+                        break;
+                    }
+                }
+            }
+        }
+#ifdef PSP_PARALLEL_FOR
+    );
+#endif
+
+    std::set<std::string> rval;
+    for (t_uindex colidx = 0; colidx < ncols; ++colidx) {
+        if (changed[colidx]) {
+            rval.insert(column_names[colidx]);
+        }
+    }
+
+    const auto& computed_columns = m_computed_column_map.m_computed_columns;
+    bool is_changed = true;
+    while (is_changed) {
+        is_changed = false;
+        for (const auto& computed : computed_columns) {
+            if (rval.find(computed.first) != rval.end()) {
+                continue;
+            }
+
+            for (const auto& input : std::get<2>(computed.second)) {
+                if (rval.find(input) != rval.end()) {
+                    rval.insert(computed.first);
+                    is_changed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return rval;
+}
+
 void
 t_gnode::_add_all_computed_columns(
     std::shared_ptr<t_data_table> table, t_dtype dtype) {
@@ -1327,6 +1520,7 @@ t_gnode::reset() {
     }
 
     m_gstate->reset();
+    m_expiry_queue = decltype(m_expiry_queue)();
 }
 
 void
@@ -1386,6 +1580,164 @@ t_gnode::repr() const {
     return ss.str();
 }
 
+void
+t_gnode::set_expiry(const std::string& colname, std::int64_t window) {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+
+    if (window > 0) {
+        if (!m_output_schema.has_column(colname)) {
+            PSP_COMPLAIN_AND_ABORT(
+                "Cannot expire rows by `" + colname + "`, as it does not exist.");
+        }
+
+        t_dtype dtype = m_output_schema.get_dtype(colname);
+        if (dtype != DTYPE_TIME && !(is_numeric_type(dtype) && !is_floating_point(dtype))) {
+            PSP_COMPLAIN_AND_ABORT("Cannot expire rows by `" + colname
+                + "` - expected a datetime or integer column, but got `"
+                + get_dtype_descr(dtype) + "`.");
+        }
+    }
+
+    m_expiry_column = colname;
+    m_expiry_window = window;
+    m_expiry_queue = decltype(m_expiry_queue)();
+
+    if (has_expiry()) {
+        // Rows already in the state are tracked from the master table, as
+        // they will not pass through `_process_table` again.
+        std::shared_ptr<const t_data_table> master_table = m_gstate->get_table();
+        std::shared_ptr<const t_column> col = master_table->get_const_column(colname);
+        std::shared_ptr<const t_column> op_col = master_table->get_const_column("psp_op");
+
+        for (t_uindex idx = 0, loop_end = master_table->size(); idx < loop_end; ++idx) {
+            if (*(op_col->get_nth<std::uint8_t>(idx)) != OP_INSERT || !col->is_valid(idx)) {
+                continue;
+            }
+            m_expiry_queue.push(t_expiry_entry(col->get_scalar(idx).to_int64(), idx));
+        }
+    }
+}
+
+bool
+t_gnode::has_expiry() const {
+    return m_expiry_window > 0;
+}
+
+std::int64_t
+t_gnode::get_expiry_deadline() const {
+    if (!has_expiry() || m_expiry_queue.empty()) {
+        return -1;
+    }
+
+    // `expire_rows` removes rows strictly older than `now - m_expiry_window`.
+    return m_expiry_queue.top().first + m_expiry_window + 1;
+}
+
+bool
+t_gnode::expire_rows() {
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+    return expire_rows(now.count());
+}
+
+bool
+t_gnode::expire_rows(std::int64_t now) {
+    PSP_TRACE_SENTINEL();
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+
+    if (!has_expiry() || m_expiry_queue.empty()) {
+        return false;
+    }
+
+    std::int64_t cutoff = now - m_expiry_window;
+    std::shared_ptr<const t_data_table> master_table = m_gstate->get_table();
+    std::shared_ptr<const t_column> col = master_table->get_const_column(m_expiry_column);
+    std::shared_ptr<const t_column> pkey_col = master_table->get_const_column("psp_pkey");
+
+    std::vector<t_tscalar> expired;
+    tsl::hopscotch_set<t_uindex> seen;
+
+    while (!m_expiry_queue.empty() && m_expiry_queue.top().first < cutoff) {
+        t_uindex ridx = m_expiry_queue.top().second;
+        m_expiry_queue.pop();
+
+        if (ridx >= master_table->size() || !col->is_valid(ridx) || seen.count(ridx) > 0) {
+            continue;
+        }
+
+        // The row may have been updated with a newer time since this entry
+        // was pushed, in which case its newer entry is still in the queue.
+        if (col->get_scalar(ridx).to_int64() >= cutoff) {
+            continue;
+        }
+
+        t_tscalar pkey = pkey_col->get_scalar(ridx);
+        t_rlookup lookup = m_gstate->lookup(pkey);
+        if (!lookup.m_exists || lookup.m_idx != ridx) {
+            continue;
+        }
+
+        seen.insert(ridx);
+        expired.push_back(pkey);
+    }
+
+    if (expired.empty()) {
+        return false;
+    }
+
+    t_data_table removes(m_input_schema);
+    removes.init();
+    removes.extend(expired.size());
+
+    for (const std::string& colname : m_input_schema.columns()) {
+        std::shared_ptr<t_column> column = removes.get_column(colname);
+        for (t_uindex idx = 0, loop_end = expired.size(); idx < loop_end; ++idx) {
+            if (colname == "psp_op") {
+                column->set_nth<std::uint8_t>(idx, OP_DELETE);
+            } else if (colname == "psp_pkey" || colname == "psp_okey") {
+                column->set_scalar(idx, expired[idx]);
+            } else {
+                column->clear(idx);
+            }
+        }
+    }
+
+    if (t_env::log_progress()) {
+        std::cout << repr() << " << t_gnode.expire_rows: "
+                  << " cutoff => " << cutoff << " expired => " << expired.size()
+                  << std::endl;
+    }
+
+    send(0, removes);
+    return true;
+}
+
+void
+t_gnode::_track_expiry(const t_data_table& flattened) {
+    if (!has_expiry()) {
+        return;
+    }
+
+    std::shared_ptr<const t_data_table> master_table = m_gstate->get_table();
+    std::shared_ptr<const t_column> col = master_table->get_const_column(m_expiry_column);
+    std::shared_ptr<const t_column> pkey_col = flattened.get_const_column("psp_pkey");
+    std::shared_ptr<const t_column> op_col = flattened.get_const_column("psp_op");
+
+    for (t_uindex idx = 0, loop_end = flattened.size(); idx < loop_end; ++idx) {
+        if (*(op_col->get_nth<std::uint8_t>(idx)) != OP_INSERT) {
+            continue;
+        }
+
+        t_rlookup lookup = m_gstate->lookup(pkey_col->get_scalar(idx));
+        if (!lookup.m_exists || !col->is_valid(lookup.m_idx)) {
+            continue;
+        }
+
+        m_expiry_queue.push(
+            t_expiry_entry(col->get_scalar(lookup.m_idx).to_int64(), lookup.m_idx));
+    }
+}
+
 #ifdef PSP_ENABLE_PYTHON
 void 
 t_gnode::set_event_loop_thread_id(std::thread::id id) {
@@ -15,6 +15,7 @@
 #include <perspective/gnode_state.h>
 #include <perspective/mask.h>
 #include <perspective/sym_table.h>
+#include <perspective/env_vars.h>
 #ifdef PSP_PARALLEL_FOR
 #include <tbb/tbb.h>
 #endif
@@ -241,6 +242,7 @@ t_gstate::update_master_table(const t_data_table* flattened) {
                 flattened_op_col,
                 master_table_indexes,
                 flattened->num_rows());
+            _maybe_compact_vocabulary(master_column);
         }
 #ifdef PSP_PARALLEL_FOR
     );
@@ -839,6 +841,37 @@ get_vec_min_max(const std::vector<t_tscalar>& vec) {
     return std::pair<t_tscalar, t_tscalar>(min, max);
 }
 
+t_uindex
+t_gstate::compact_vocabularies() {
+    t_uindex dropped = 0;
+    for (auto column : m_table->get_columns()) {
+        if (column->get_dtype() == DTYPE_STR) {
+            dropped += column->compact_vocabulary();
+        }
+    }
+    return dropped;
+}
+
+void
+t_gstate::_maybe_compact_vocabulary(t_column* column) const {
+    if (column->get_dtype() != DTYPE_STR) {
+        return;
+    }
+
+    t_uindex vlenidx = column->get_vlenidx();
+    if (vlenidx < PSP_VOCAB_COMPACT_MIN_SIZE
+        || vlenidx < PSP_VOCAB_COMPACT_RATIO * (m_mapping.size() + 1)) {
+        return;
+    }
+
+    t_uindex dropped = column->compact_vocabulary();
+
+    if (t_env::log_progress()) {
+        std::cout << "t_gstate.compact_vocabulary: vlenidx => " << vlenidx
+                  << " dropped => " << dropped << std::endl;
+    }
+}
+
 t_uindex
 t_gstate::mapping_size() const {
     return m_mapping.size();
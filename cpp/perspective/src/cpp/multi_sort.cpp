@@ -10,9 +10,16 @@
 #include <perspective/first.h>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <perspective/base.h>
+#include <perspective/column.h>
 #include <perspective/multi_sort.h>
 #include <perspective/scalar.h>
+#include <cstring>
+#include <numeric>
 #include <vector>
+#ifdef PSP_PARALLEL_FOR
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
 
 namespace perspective {
 
@@ -226,4 +233,240 @@ t_multisorter::operator()(t_index a, t_index b) const {
     return this->operator()((*m_elems)[a], (*m_elems)[b]);
 }
 
+namespace {
+
+const std::uint64_t SORT_KEY_SIGN_BIT = std::uint64_t(1) << 63;
+
+std::uint64_t
+encode_signed(std::int64_t v) {
+    return static_cast<std::uint64_t>(v) ^ SORT_KEY_SIGN_BIT;
+}
+
+// Order-preserving bits of a non-NaN double, with -0 and 0 encoded alike.
+std::uint64_t
+encode_double(double v) {
+    if (v == 0) {
+        v = 0;
+    }
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return (bits & SORT_KEY_SIGN_BIT) ? ~bits : bits | SORT_KEY_SIGN_BIT;
+}
+
+std::uint64_t
+encode_scalar(const t_tscalar& value) {
+    switch (value.get_dtype()) {
+        case DTYPE_INT64:
+        case DTYPE_TIME: {
+            return encode_signed(value.m_data.m_int64);
+        } break;
+        case DTYPE_INT32: {
+            return encode_signed(value.m_data.m_int32);
+        } break;
+        case DTYPE_INT16: {
+            return encode_signed(value.m_data.m_int16);
+        } break;
+        case DTYPE_INT8: {
+            return encode_signed(value.m_data.m_int8);
+        } break;
+        case DTYPE_UINT64:
+        case DTYPE_OBJECT: {
+            return value.m_data.m_uint64;
+        } break;
+        case DTYPE_UINT32:
+        case DTYPE_DATE: {
+            return value.m_data.m_uint32;
+        } break;
+        case DTYPE_UINT16: {
+            return value.m_data.m_uint16;
+        } break;
+        case DTYPE_UINT8: {
+            return value.m_data.m_uint8;
+        } break;
+        case DTYPE_BOOL: {
+            return value.m_data.m_bool;
+        } break;
+        case DTYPE_FLOAT64: {
+            return encode_double(value.m_data.m_float64);
+        } break;
+        case DTYPE_FLOAT32: {
+            return encode_double(value.m_data.m_float32);
+        } break;
+        default: { return 0; }
+    }
+}
+
+// The rank of each string in `col`'s vocabulary, such that equal strings
+// share a rank.
+std::vector<std::uint64_t>
+rank_vocab(const t_column& col) {
+    t_uindex nstrings = col.get_vlenidx();
+    std::vector<t_uindex> ids(nstrings);
+    std::iota(ids.begin(), ids.end(), 0);
+
+    PSP_PSORT(ids.begin(), ids.end(), [&col](t_uindex a, t_uindex b) {
+        return std::strcmp(col.unintern_c(a), col.unintern_c(b)) < 0;
+    });
+
+    std::vector<std::uint64_t> ranks(nstrings);
+    for (t_uindex idx = 0; idx < nstrings; ++idx) {
+        bool eq_prev
+            = idx > 0 && std::strcmp(col.unintern_c(ids[idx - 1]), col.unintern_c(ids[idx])) == 0;
+        ranks[ids[idx]] = eq_prev ? ranks[ids[idx - 1]] : idx;
+    }
+
+    return ranks;
+}
+
+bool
+is_nan_scalar(const t_tscalar& value) {
+    return value.is_floating_point() && std::isnan(value.to_double());
+}
+
+} // end anonymous namespace
+
+t_sort_keys::t_sort_keys(t_uindex nrows, const std::vector<t_sorttype>& sort_order)
+    : m_nwords(sort_order.size() * 2)
+    , m_sort_order(sort_order)
+    , m_keys(nrows * sort_order.size() * 2) {}
+
+bool
+t_sort_keys::is_encodable(t_dtype dtype) {
+    switch (dtype) {
+        case DTYPE_INT64:
+        case DTYPE_INT32:
+        case DTYPE_INT16:
+        case DTYPE_INT8:
+        case DTYPE_UINT64:
+        case DTYPE_UINT32:
+        case DTYPE_UINT16:
+        case DTYPE_UINT8:
+        case DTYPE_FLOAT64:
+        case DTYPE_FLOAT32:
+        case DTYPE_BOOL:
+        case DTYPE_DATE:
+        case DTYPE_TIME:
+        case DTYPE_OBJECT:
+        case DTYPE_STR: {
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// The first word is the class of the value - NaN first, then by status, which
+// is how `cmp_mselem` orders them - and the second its data, or its magnitude
+// for `_ABS` sorts. Descending sorts invert both words.
+void
+t_sort_keys::encode_column(
+    t_uindex cidx, const t_column& col, const std::vector<t_uindex>& ridxs) {
+    t_sorttype order = m_sort_order[cidx];
+    bool by_value = order == SORTTYPE_ASCENDING || order == SORTTYPE_DESCENDING;
+    bool is_str = col.get_dtype() == DTYPE_STR;
+    bool invert = order == SORTTYPE_DESCENDING || order == SORTTYPE_DESCENDING_ABS;
+
+    std::vector<std::uint64_t> ranks;
+    if (is_str && by_value) {
+        ranks = rank_vocab(col);
+    }
+
+    std::uint64_t* keys = m_keys.data();
+    t_uindex nwords = m_nwords;
+
+#ifdef PSP_PARALLEL_FOR
+    tbb::parallel_for(0, int(ridxs.size()), 1,
+        [&](int idx)
+#else
+    for (t_uindex idx = 0, loop_end = ridxs.size(); idx < loop_end; ++idx)
+#endif
+        {
+            t_uindex ridx = ridxs[idx];
+            t_tscalar value = col.get_scalar(ridx);
+            bool is_nan = is_nan_scalar(value);
+            std::uint64_t cls = 0;
+            std::uint64_t data = 0;
+
+            if (!is_nan) {
+                switch (order) {
+                    case SORTTYPE_ASCENDING:
+                    case SORTTYPE_DESCENDING: {
+                        cls = 1 + value.m_status;
+                        data = is_str ? ranks[*(col.get_nth<t_uindex>(ridx))]
+                                      : encode_scalar(value);
+                    } break;
+                    case SORTTYPE_ASCENDING_ABS:
+                    case SORTTYPE_DESCENDING_ABS: {
+                        cls = 1;
+                        data = encode_double(std::abs(value.to_double()));
+                    } break;
+                    case SORTTYPE_NONE: {
+                        cls = 1;
+                    } break;
+                }
+            }
+
+            std::uint64_t* key = keys + idx * nwords + cidx * 2;
+            key[0] = invert ? ~cls : cls;
+            key[1] = invert ? ~data : data;
+        }
+#ifdef PSP_PARALLEL_FOR
+    );
+#endif
+}
+
+const std::uint64_t*
+t_sort_keys::get(t_uindex idx) const {
+    return m_keys.data() + idx * m_nwords;
+}
+
+t_sort_key_sorter::t_sort_key_sorter(
+    const t_sort_keys& keys, const std::vector<t_mselem>& elems)
+    : m_keys(keys)
+    , m_elems(elems) {}
+
+bool
+t_sort_key_sorter::operator()(t_uindex a, t_uindex b) const {
+    const std::uint64_t* akey = m_keys.get(a);
+    const std::uint64_t* bkey = m_keys.get(b);
+    const t_mselem& aelem = m_elems[a];
+    const t_mselem& belem = m_elems[b];
+
+    for (t_uindex cidx = 0, loop_end = m_keys.m_sort_order.size(); cidx < loop_end; ++cidx) {
+        t_uindex widx = cidx * 2;
+        if (akey[widx] != bkey[widx]) {
+            return akey[widx] < bkey[widx];
+        }
+
+        if (akey[widx + 1] != bkey[widx + 1]) {
+            return akey[widx + 1] < bkey[widx + 1];
+        }
+
+        t_sorttype order = m_keys.m_sort_order[cidx];
+        if (order == SORTTYPE_ASCENDING || order == SORTTYPE_DESCENDING) {
+            continue;
+        }
+
+        // Different values of equal magnitude are ordered by pkey.
+        const t_tscalar& first = aelem.m_row[cidx];
+        const t_tscalar& second = belem.m_row[cidx];
+        if (first == second || is_nan_scalar(first)) {
+            continue;
+        }
+
+        if (order == SORTTYPE_DESCENDING_ABS) {
+            return aelem.m_pkey > belem.m_pkey;
+        }
+
+        return aelem.m_pkey < belem.m_pkey;
+    }
+
+    if (aelem.m_order != belem.m_order) {
+        return aelem.m_order < belem.m_order;
+    }
+
+    return aelem.m_pkey < belem.m_pkey;
+}
+
 } // end namespace perspective
@@ -13,6 +13,7 @@
 #include <perspective/update_task.h>
 #include <perspective/compat.h>
 #include <perspective/env_vars.h>
+#include <perspective/pyutils.h>
 #ifdef PSP_ENABLE_PYTHON
 #include <thread>
 #endif
@@ -20,12 +21,31 @@
 
 namespace perspective {
 
+namespace {
+
+std::int64_t
+now_ms() {
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+    return now.count();
+}
+
+} // namespace
+
 t_updctx::t_updctx() {}
 
 t_updctx::t_updctx(t_uindex gnode_id, const std::string& ctx)
     : m_gnode_id(gnode_id)
     , m_ctx(ctx) {}
 
+t_pool_metrics::t_pool_metrics()
+    : m_queued_batches(0)
+    , m_queued_rows(0)
+    , m_num_processed(0)
+    , m_batches_processed(0)
+    , m_rows_processed(0)
+    , m_max_batch_rows(0) {}
+
 #if defined PSP_ENABLE_WASM
 
 t_val
@@ -37,7 +57,8 @@ empty_callback() {
 
 t_pool::t_pool()
     : m_update_delegate(empty_callback()) 
-    , m_sleep(0) {
+    , m_sleep(0)
+    , m_expiry_deadline(-1) {
         m_run.clear();
     }
 
@@ -49,22 +70,40 @@ empty_callback() {
 }
 
 t_pool::t_pool()
-    : m_update_delegate(empty_callback())
-    , m_event_loop_thread_id(std::thread::id())
-    , m_sleep(0) {
+    : m_event_loop_thread_id(std::thread::id())
+    , m_processing_stop(false)
+    , m_processing_window(0)
+    , m_processing_max_rows(0)
+    , m_update_delegate(empty_callback())
+    , m_sleep(0)
+    , m_expiry_deadline(-1) {
         m_run.clear();
     }
 
 #else
 
 t_pool::t_pool()
-    : m_sleep(0) {
+    : m_sleep(0)
+    , m_expiry_deadline(-1) {
         m_run.clear();
     }
 
 #endif
 
-t_pool::~t_pool() {}
+t_pool::~t_pool() {
+#ifdef PSP_ENABLE_PYTHON
+    if (m_processing_thread.joinable()) {
+        if (on_processing_thread()) {
+            // The processing thread released the last reference after
+            // `_process`, and exits without touching the pool again.
+            m_processing_thread.detach();
+        } else {
+            PerspectiveScopedGILRelease release{std::thread::id()};
+            stop_processing_thread();
+        }
+    }
+#endif
+}
 
 void
 t_pool::init() {
@@ -115,11 +154,17 @@ t_pool::send(t_uindex gnode_id, t_uindex port_id, const t_data_table& table) {
     {
         std::lock_guard<std::mutex> lg(m_mtx);
         m_data_remaining.store(true);
+        m_metrics.m_queued_batches++;
+        m_metrics.m_queued_rows += table.size();
 
         if (m_gnodes[gnode_id]) {
             m_gnodes[gnode_id]->send(port_id, table);
         }
 
+#ifdef PSP_ENABLE_PYTHON
+        m_processing_cv.notify_one();
+#endif
+
         if (t_env::log_progress()) {
             std::cout << "t_pool.send gnode_id => " << gnode_id << " port_id => " << port_id
                       << " tbl_size => " << table.size() << std::endl;
@@ -143,14 +188,149 @@ void t_pool::set_event_loop() {
 std::thread::id t_pool::get_event_loop_thread_id() const {
     return m_event_loop_thread_id;
 }
+
+std::recursive_mutex& t_pool::get_engine_mutex() {
+    return m_engine_mtx;
+}
+
+void
+t_pool::start_processing_thread(t_uindex window_ms, t_uindex max_rows) {
+    m_processing_window.store(window_ms);
+    m_processing_max_rows.store(max_rows);
+    if (m_processing_thread.joinable()) {
+        if (!m_processing_stop || on_processing_thread()) {
+            // Still running, or stopped by the update callback calling us,
+            // in which case the loop has not exited yet and can resume.
+            m_processing_stop = false;
+            return;
+        }
+
+        // Stopped from an update callback, but not yet joined.
+        PerspectiveScopedGILRelease release{std::thread::id()};
+        m_processing_thread.join();
+    }
+
+    m_processing_stop = false;
+    m_processing_thread = std::thread(
+        &t_pool::_processing_loop, this, std::weak_ptr<t_pool>(shared_from_this()));
+    set_thread_name(m_processing_thread, "psp_process_thread");
+
+    if (t_env::log_progress()) {
+        std::cout << "t_pool.start_processing_thread window_ms => " << window_ms
+                  << " max_rows => " << max_rows << std::endl;
+    }
+}
+
+void
+t_pool::stop_processing_thread() {
+    if (!m_processing_thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_processing_stop = true;
+    }
+
+    m_processing_cv.notify_one();
+
+    // From an update callback, the loop exits once `_process` returns, and
+    // the thread is joined by the next `start_processing_thread` or by the
+    // destructor.
+    if (on_processing_thread()) {
+        return;
+    }
+
+    m_processing_thread.join();
+
+    if (t_env::log_progress()) {
+        std::cout << "t_pool.stop_processing_thread" << std::endl;
+    }
+}
+
+bool
+t_pool::has_processing_thread() const {
+    return m_processing_thread.joinable() && !m_processing_stop;
+}
+
+bool
+t_pool::on_processing_thread() const {
+    return m_processing_thread.get_id() == std::this_thread::get_id();
+}
+
+void
+t_pool::_processing_loop(std::weak_ptr<t_pool> weak_self) {
+    while (true) {
+        {
+            // Wait without owning the pool - if it is destroyed from another
+            // thread meanwhile, the destructor stops and joins this one. Wake
+            // for an update, or when the earliest row is due to expire so
+            // that an idle table still expires its rows.
+            std::unique_lock<std::mutex> lk(m_mtx);
+            while (!m_processing_stop && !m_data_remaining.load()) {
+                std::int64_t deadline = m_expiry_deadline.load();
+                if (deadline < 0) {
+                    m_processing_cv.wait(lk);
+                } else if (deadline > now_ms()) {
+                    m_processing_cv.wait_until(lk,
+                        std::chrono::system_clock::time_point(
+                            std::chrono::milliseconds(deadline)));
+                } else {
+                    break;
+                }
+            }
+
+            if (m_processing_stop) {
+                return;
+            }
+
+            // Let updates sent within the window accumulate in the input
+            // ports, so they are processed together, unless enough rows are
+            // already queued.
+            t_uindex window = m_processing_window.load();
+            t_uindex max_rows = m_processing_max_rows.load();
+            if (window > 0 && m_data_remaining.load()) {
+                m_processing_cv.wait_for(lk, std::chrono::milliseconds(window), [this, max_rows] {
+                    return m_processing_stop
+                        || (max_rows > 0 && m_metrics.m_queued_rows >= max_rows);
+                });
+            }
+        }
+
+        // Own the pool while processing, so that an update callback which
+        // drops the last reference to it does not destroy it under `_process`.
+        std::shared_ptr<t_pool> self = weak_self.lock();
+        if (!self) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::recursive_mutex> engine(m_engine_mtx);
+            _process();
+        }
+
+        // If that was the last reference, the pool is destroyed here on this
+        // thread, which must not touch it again.
+        self.reset();
+        if (weak_self.expired()) {
+            return;
+        }
+    }
+}
 #endif
 
 void
 t_pool::_process() {
     auto work_to_do = m_data_remaining.load();
+    if (!work_to_do) {
+        std::int64_t deadline = m_expiry_deadline.load();
+        work_to_do = deadline >= 0 && deadline <= now_ms();
+    }
+
     if (work_to_do) {
         t_update_task task(*this);
         task.run();
+        update_expiry_deadline();
     }
 }
 
@@ -203,6 +383,12 @@ t_pool::register_context(
 void
 t_pool::register_context(
     t_uindex gnode_id, const std::string& name, t_ctx_type type, std::int64_t ptr) {
+#ifdef PSP_ENABLE_PYTHON
+    // The gnode's contexts must not change while `_process` notifies them on
+    // another thread.
+    PerspectiveScopedGILRelease release{std::thread::id()};
+    std::lock_guard<std::recursive_mutex> engine(m_engine_mtx);
+#endif
     std::lock_guard<std::mutex> lg(m_mtx);
     if (!validate_gnode_id(gnode_id))
         return;
@@ -222,6 +408,8 @@ t_pool::notify_userspace(t_uindex port_id) {
     #if defined PSP_ENABLE_WASM
         m_update_delegate.call<void>("_update_callback", port_id);
     #elif PSP_ENABLE_PYTHON
+        // `_process` runs with the GIL released.
+        PerspectiveScopedGILAcquire acquire;
         if (!m_update_delegate.is_none()) {
             m_update_delegate.attr("_update_callback")(port_id);
         }
@@ -230,6 +418,12 @@ t_pool::notify_userspace(t_uindex port_id) {
 
 void
 t_pool::unregister_context(t_uindex gnode_id, const std::string& name) {
+#ifdef PSP_ENABLE_PYTHON
+    // As in `register_context`. Called from `~View`, which may run on any
+    // thread, so it is not held to the event loop thread.
+    PerspectiveScopedGILRelease release{std::thread::id()};
+    std::lock_guard<std::recursive_mutex> engine(m_engine_mtx);
+#endif
     std::lock_guard<std::mutex> lg(m_mtx);
 
     if (t_env::log_progress()) {
@@ -248,6 +442,55 @@ t_pool::get_data_remaining() const {
     return data;
 }
 
+std::int64_t
+t_pool::get_expiry_deadline() const {
+    return m_expiry_deadline.load();
+}
+
+void
+t_pool::update_expiry_deadline() {
+    std::int64_t deadline = -1;
+    for (auto g : m_gnodes) {
+        if (g) {
+            std::int64_t gdeadline = g->get_expiry_deadline();
+            if (gdeadline >= 0 && (deadline < 0 || gdeadline < deadline)) {
+                deadline = gdeadline;
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_expiry_deadline.store(deadline);
+    }
+
+#ifdef PSP_ENABLE_PYTHON
+    m_processing_cv.notify_one();
+#endif
+}
+
+t_pool_metrics
+t_pool::get_metrics() {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return m_metrics;
+}
+
+void
+t_pool::record_processed_batch() {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_metrics.m_queued_batches == 0) {
+        return;
+    }
+
+    m_metrics.m_num_processed++;
+    m_metrics.m_batches_processed += m_metrics.m_queued_batches;
+    m_metrics.m_rows_processed += m_metrics.m_queued_rows;
+    m_metrics.m_max_batch_rows
+        = std::max(m_metrics.m_max_batch_rows, m_metrics.m_queued_rows);
+    m_metrics.m_queued_batches = 0;
+    m_metrics.m_queued_rows = 0;
+}
+
 std::vector<t_tscalar>
 t_pool::get_row_data_pkeys(t_uindex gnode_id, const std::vector<t_tscalar>& pkeys) {
     std::lock_guard<std::mutex> lg(m_mtx);
@@ -24,19 +24,19 @@ t_process_state::clear_transitional_data_tables() {
 
 void
 t_process_state::reserve_transitional_data_tables(t_uindex size) {
-    m_delta_data_table->reserve(size);
-    m_prev_data_table->reserve(size);
-    m_current_data_table->reserve(size);
-    m_transitions_data_table->reserve(size);
+    m_delta_data_table->reserve(size, m_column_names);
+    m_prev_data_table->reserve(size, m_column_names);
+    m_current_data_table->reserve(size, m_column_names);
+    m_transitions_data_table->reserve(size, m_column_names);
     m_existed_data_table->reserve(size);
 };
 
 void
 t_process_state::set_size_transitional_data_tables(t_uindex size) {
-    m_delta_data_table->set_size(size);
-    m_prev_data_table->set_size(size);
-    m_current_data_table->set_size(size);
-    m_transitions_data_table->set_size(size);
+    m_delta_data_table->set_size(size, m_column_names);
+    m_prev_data_table->set_size(size, m_column_names);
+    m_current_data_table->set_size(size, m_column_names);
+    m_transitions_data_table->set_size(size, m_column_names);
     m_existed_data_table->set_size(size);
 };
 
@@ -11,25 +11,55 @@
 #include <perspective/base.h>
 #include <perspective/pyutils.h>
 #ifdef PSP_ENABLE_PYTHON
+#include <perspective/pool.h>
+
 namespace perspective {
 
-PerspectiveScopedGILRelease::PerspectiveScopedGILRelease(std::thread::id event_loop_thread_id) : m_thread_state(NULL) {
-    if (event_loop_thread_id != std::thread::id()) {
+PerspectiveScopedGILRelease::PerspectiveScopedGILRelease(std::thread::id event_loop_thread_id)
+    : m_thread_state(NULL)
+    , m_engine_mtx(nullptr) {
+    // Only calls from Python are held to the event loop thread; engine
+    // threads that never took the GIL are exempt.
+    if (event_loop_thread_id != std::thread::id() && PyGILState_Check()) {
         if (std::this_thread::get_id() != event_loop_thread_id) {
             std::stringstream err;
             err << "Perspective called from wrong thread; Expected " << event_loop_thread_id << "; Got " << std::this_thread::get_id() << std::endl;
             PSP_COMPLAIN_AND_ABORT(err.str());
         }
+    }
+
+    // Nested scopes, and engine threads that were never given the GIL, have
+    // nothing to release.
+    if (PyGILState_Check()) {
         m_thread_state = PyEval_SaveThread();
     }
 }
 
+PerspectiveScopedGILRelease::PerspectiveScopedGILRelease(t_pool& pool)
+    : PerspectiveScopedGILRelease(pool.on_processing_thread()
+        ? std::thread::id()
+        : pool.get_event_loop_thread_id()) {
+    m_engine_mtx = &pool.get_engine_mutex();
+    m_engine_mtx->lock();
+}
+
 PerspectiveScopedGILRelease::~PerspectiveScopedGILRelease() {
-     if (m_thread_state != NULL) {
+    if (m_engine_mtx != nullptr) {
+        m_engine_mtx->unlock();
+    }
+
+    if (m_thread_state != NULL) {
         PyEval_RestoreThread(m_thread_state);
     }
 }
 
+PerspectiveScopedGILAcquire::PerspectiveScopedGILAcquire()
+    : m_state(PyGILState_Ensure()) {}
+
+PerspectiveScopedGILAcquire::~PerspectiveScopedGILAcquire() {
+    PyGILState_Release(m_state);
+}
+
 } // end namespace perspective
 
 #endif
\ No newline at end of file
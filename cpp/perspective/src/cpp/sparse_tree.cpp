@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <limits>
 #include <perspective/base.h>
 #include <perspective/compat.h>
 #include <perspective/extract_aggregate.h>
@@ -29,6 +30,10 @@
 #include <perspective/context_two.h>
 #include <set>
 
+#ifdef PSP_PARALLEL_FOR
+#include <tbb/parallel_for.h>
+#endif
+
 namespace perspective {
 
 t_tscalar
@@ -78,7 +83,8 @@ t_stree::t_stree(const std::vector<t_pivot>& pivots, const std::vector<t_aggspec
     , m_aggspecs(aggspecs)
     , m_schema(schema)
     , m_cur_aggidx(1)
-    , m_has_delta(false) {
+    , m_has_delta(false)
+    , m_lazy_aggregates(false) {
     auto g_agg_str = cfg.get_grand_agg_str();
     m_grand_agg_str = g_agg_str.empty() ? "Grand Aggregate" : g_agg_str;
 }
@@ -297,9 +303,344 @@ t_stree::build_strand_table_common(const t_data_table& flattened,
     }
 
     rv.m_aggschema.add_column("psp_strand_count", DTYPE_INT8);
+    rv.m_naggcols = rv.m_aggschema.size();
+
+    for (const auto& aggspec : aggspecs) {
+        if (!aggspec.is_incremental_mean()) {
+            continue;
+        }
+
+        const auto& deps = aggspec.get_dependencies();
+        t_mean_accumulator acc;
+        acc.m_agg = aggspec.agg();
+        acc.m_value_colname = deps[0].name();
+        if (acc.m_agg == AGGTYPE_WEIGHTED_MEAN) {
+            acc.m_weight_colname = deps[1].name();
+        }
+        acc.m_nr_colname = aggspec.get_mean_numerator_colname();
+        acc.m_dr_colname = aggspec.get_mean_denominator_colname();
+
+        rv.m_aggschema.add_column(acc.m_nr_colname, DTYPE_FLOAT64);
+        rv.m_aggschema.add_column(acc.m_dr_colname, DTYPE_FLOAT64);
+        rv.m_mean_accumulators.push_back(acc);
+    }
+
+    for (const auto& aggspec : aggspecs) {
+        if (!aggspec.is_incremental_extreme()) {
+            continue;
+        }
+
+        // Extremes of other types are still reduced from the gstate.
+        const std::string& value_colname = aggspec.get_dependencies()[0].name();
+        t_dtype dtype = rv.m_flattened_schema.get_dtype(value_colname);
+        if (!is_numeric_type(dtype) && dtype != DTYPE_DATE && dtype != DTYPE_TIME
+            && dtype != DTYPE_BOOL) {
+            continue;
+        }
+
+        t_extreme_accumulator acc;
+        acc.m_agg = aggspec.agg();
+        acc.m_value_colname = value_colname;
+        acc.m_in_colname = aggspec.get_extreme_in_colname();
+        acc.m_out_colname = aggspec.get_extreme_out_colname();
+
+        rv.m_aggschema.add_column(acc.m_in_colname, dtype);
+        rv.m_aggschema.add_column(acc.m_out_colname, dtype);
+        rv.m_extreme_accumulators.push_back(acc);
+    }
+
     return rv;
 }
 
+namespace {
+
+// The columns read and written for one mean accumulator while building a
+// strand table.
+struct t_mean_accumulator_cols {
+    t_aggtype m_agg;
+    const t_column* m_pvalue;
+    const t_column* m_pweight;
+    const t_column* m_cvalue;
+    const t_column* m_cweight;
+    t_column* m_nr;
+    t_column* m_dr;
+};
+
+// The contribution of row `idx` to the (numerator, denominator) of a mean,
+// which counts the same rows `update_agg_table` would read from the gstate.
+std::pair<double, double>
+mean_contribution(
+    t_aggtype agg, const t_column* values, const t_column* weights, t_uindex idx) {
+    t_tscalar value = values->get_scalar(idx);
+
+    if (agg == AGGTYPE_WEIGHTED_MEAN) {
+        t_tscalar weight = weights->get_scalar(idx);
+        if (!value.is_valid() || !weight.is_valid() || value.is_nan() || weight.is_nan()) {
+            return std::pair<double, double>(0, 0);
+        }
+
+        return std::pair<double, double>(
+            weight.to_double() * value.to_double(), weight.to_double());
+    }
+
+    if (!value.is_valid()) {
+        return std::pair<double, double>(0, 0);
+    }
+
+    return std::pair<double, double>(value.to_double(), 1);
+}
+
+// Push `sign` times the contribution of `idx` in the current rows, minus that
+// in the previous rows if `subtract_prev`.
+void
+push_mean_accumulators(std::vector<t_mean_accumulator_cols>& accs, t_uindex idx,
+    double sign, bool subtract_prev) {
+    for (auto& acc : accs) {
+        std::pair<double, double> contrib(0, 0);
+
+        if (sign != 0) {
+            contrib = mean_contribution(acc.m_agg, acc.m_cvalue, acc.m_cweight, idx);
+            contrib.first *= sign;
+            contrib.second *= sign;
+        }
+
+        if (subtract_prev) {
+            auto prev = mean_contribution(acc.m_agg, acc.m_pvalue, acc.m_pweight, idx);
+            contrib.first -= prev.first;
+            contrib.second -= prev.second;
+        }
+
+        acc.m_nr->push_back<double>(contrib.first);
+        acc.m_dr->push_back<double>(contrib.second);
+    }
+}
+
+std::vector<t_mean_accumulator_cols>
+get_mean_accumulator_cols(const t_build_strand_table_common_rval& rv,
+    const t_data_table& prev, const t_data_table& current, t_data_table& aggs) {
+    std::vector<t_mean_accumulator_cols> rval;
+
+    for (const auto& acc : rv.m_mean_accumulators) {
+        bool weighted = acc.m_agg == AGGTYPE_WEIGHTED_MEAN;
+        t_mean_accumulator_cols cols;
+        cols.m_agg = acc.m_agg;
+        cols.m_pvalue = prev.get_const_column(acc.m_value_colname).get();
+        cols.m_cvalue = current.get_const_column(acc.m_value_colname).get();
+        cols.m_pweight
+            = weighted ? prev.get_const_column(acc.m_weight_colname).get() : nullptr;
+        cols.m_cweight
+            = weighted ? current.get_const_column(acc.m_weight_colname).get() : nullptr;
+        cols.m_nr = aggs.get_column(acc.m_nr_colname).get();
+        cols.m_dr = aggs.get_column(acc.m_dr_colname).get();
+        rval.push_back(cols);
+    }
+
+    return rval;
+}
+
+void
+valid_raw_fill_mean_accumulators(std::vector<t_mean_accumulator_cols>& accs) {
+    for (auto& acc : accs) {
+        acc.m_nr->valid_raw_fill();
+        acc.m_dr->valid_raw_fill();
+    }
+}
+
+// The columns read and written for one extreme accumulator while building a
+// strand table.
+struct t_extreme_accumulator_cols {
+    bool m_is_max;
+    t_tscalar m_identity;
+    const t_column* m_pvalue;
+    const t_column* m_cvalue;
+    t_column* m_in;
+    t_column* m_out;
+};
+
+// The value below (for a max) or above (for a min) every value of `dtype`,
+// which is pushed when no value enters or leaves a node.
+t_tscalar
+extreme_identity(t_dtype dtype, bool is_max) {
+    t_tscalar rval;
+    rval.clear();
+
+    switch (dtype) {
+        case DTYPE_INT64: {
+            rval.set(is_max ? std::numeric_limits<std::int64_t>::lowest()
+                            : std::numeric_limits<std::int64_t>::max());
+        } break;
+        case DTYPE_INT32: {
+            rval.set(is_max ? std::numeric_limits<std::int32_t>::lowest()
+                            : std::numeric_limits<std::int32_t>::max());
+        } break;
+        case DTYPE_INT16: {
+            rval.set(is_max ? std::numeric_limits<std::int16_t>::lowest()
+                            : std::numeric_limits<std::int16_t>::max());
+        } break;
+        case DTYPE_INT8: {
+            rval.set(is_max ? std::numeric_limits<std::int8_t>::lowest()
+                            : std::numeric_limits<std::int8_t>::max());
+        } break;
+        case DTYPE_UINT64: {
+            rval.set(is_max ? std::numeric_limits<std::uint64_t>::lowest()
+                            : std::numeric_limits<std::uint64_t>::max());
+        } break;
+        case DTYPE_UINT32: {
+            rval.set(is_max ? std::numeric_limits<std::uint32_t>::lowest()
+                            : std::numeric_limits<std::uint32_t>::max());
+        } break;
+        case DTYPE_UINT16: {
+            rval.set(is_max ? std::numeric_limits<std::uint16_t>::lowest()
+                            : std::numeric_limits<std::uint16_t>::max());
+        } break;
+        case DTYPE_UINT8: {
+            rval.set(is_max ? std::numeric_limits<std::uint8_t>::lowest()
+                            : std::numeric_limits<std::uint8_t>::max());
+        } break;
+        case DTYPE_FLOAT64: {
+            rval.set(is_max ? -std::numeric_limits<double>::infinity()
+                            : std::numeric_limits<double>::infinity());
+        } break;
+        case DTYPE_FLOAT32: {
+            rval.set(is_max ? -std::numeric_limits<float>::infinity()
+                            : std::numeric_limits<float>::infinity());
+        } break;
+        case DTYPE_BOOL: {
+            rval.set(!is_max);
+        } break;
+        case DTYPE_TIME: {
+            rval.set(t_time(is_max ? std::numeric_limits<t_time::t_rawtype>::lowest()
+                                   : std::numeric_limits<t_time::t_rawtype>::max()));
+        } break;
+        case DTYPE_DATE: {
+            rval.set(t_date(is_max ? std::numeric_limits<t_date::t_rawtype>::lowest()
+                                   : std::numeric_limits<t_date::t_rawtype>::max()));
+        } break;
+        default: { PSP_COMPLAIN_AND_ABORT("Unexpected extreme accumulator dtype"); }
+    }
+
+    return rval;
+}
+
+// Push the value of `idx` in the current rows as entering its node if
+// `enters`, and that in the previous rows as leaving it if `leaves`; a row
+// which stays in its node with the same value neither enters nor leaves.
+void
+push_extreme_accumulators(
+    std::vector<t_extreme_accumulator_cols>& accs, t_uindex idx, bool enters, bool leaves) {
+    for (auto& acc : accs) {
+        t_tscalar in = enters ? acc.m_cvalue->get_scalar(idx) : acc.m_identity;
+        t_tscalar out = leaves ? acc.m_pvalue->get_scalar(idx) : acc.m_identity;
+
+        if (enters && leaves && in == out) {
+            in = acc.m_identity;
+            out = acc.m_identity;
+        }
+
+        if (!in.is_valid() || in.is_nan()) {
+            in = acc.m_identity;
+        }
+
+        if (!out.is_valid() || out.is_nan()) {
+            out = acc.m_identity;
+        }
+
+        acc.m_in->push_back(in);
+        acc.m_out->push_back(out);
+    }
+}
+
+std::vector<t_extreme_accumulator_cols>
+get_extreme_accumulator_cols(const t_build_strand_table_common_rval& rv,
+    const t_data_table& prev, const t_data_table& current, t_data_table& aggs) {
+    std::vector<t_extreme_accumulator_cols> rval;
+
+    for (const auto& acc : rv.m_extreme_accumulators) {
+        t_extreme_accumulator_cols cols;
+        cols.m_is_max = acc.m_agg == AGGTYPE_MAX;
+        cols.m_pvalue = prev.get_const_column(acc.m_value_colname).get();
+        cols.m_cvalue = current.get_const_column(acc.m_value_colname).get();
+        cols.m_in = aggs.get_column(acc.m_in_colname).get();
+        cols.m_out = aggs.get_column(acc.m_out_colname).get();
+        cols.m_identity = extreme_identity(cols.m_in->get_dtype(), cols.m_is_max);
+        rval.push_back(cols);
+    }
+
+    return rval;
+}
+
+void
+valid_raw_fill_extreme_accumulators(std::vector<t_extreme_accumulator_cols>& accs) {
+    for (auto& acc : accs) {
+        acc.m_in->valid_raw_fill();
+        acc.m_out->valid_raw_fill();
+    }
+}
+
+// A sum into a node created by this step is just the strand aggregate of
+// the node, so copy it over without boxing each value in a `t_tscalar`.
+template <typename T>
+void
+copy_fresh_sums(
+    const t_column* src, t_column* dst, const std::vector<t_tree_unify_rec>& recs) {
+    for (const auto& r : recs) {
+        if (src->is_valid(r.m_daggidx)) {
+            dst->set_nth<T>(r.m_saggidx, *(src->get_nth<T>(r.m_daggidx)));
+        }
+    }
+}
+
+// Fill column `idx` of `info` for the fresh nodes in `recs`, or return
+// `false` if it must go through `update_agg_table`.
+bool
+update_fresh_aggs(
+    const t_agg_update_info& info, t_uindex idx, const std::vector<t_tree_unify_rec>& recs) {
+    const t_column* src = info.m_src[idx];
+    t_column* dst = info.m_dst[idx];
+
+    switch (info.m_aggspecs[idx].agg()) {
+        case AGGTYPE_COUNT: {
+            if (dst->get_dtype() != DTYPE_INT64) {
+                return false;
+            }
+
+            for (const auto& r : recs) {
+                std::int64_t nstrands = r.m_nstrands;
+                dst->set_nth<std::int64_t>(
+                    r.m_saggidx, r.m_sptidx == 0 ? nstrands - 1 : nstrands);
+            }
+
+            return true;
+        }
+        case AGGTYPE_PCT_SUM_PARENT:
+        case AGGTYPE_PCT_SUM_GRAND_TOTAL:
+        case AGGTYPE_SUM: {
+            if (src->get_dtype() != dst->get_dtype() || !src->is_status_enabled()
+                || !dst->is_status_enabled()) {
+                return false;
+            }
+
+            switch (dst->get_dtype()) {
+                case DTYPE_INT64: {
+                    copy_fresh_sums<std::int64_t>(src, dst, recs);
+                } break;
+                case DTYPE_UINT64: {
+                    copy_fresh_sums<std::uint64_t>(src, dst, recs);
+                } break;
+                case DTYPE_FLOAT64: {
+                    copy_fresh_sums<double>(src, dst, recs);
+                } break;
+                default: { return false; }
+            }
+
+            return true;
+        }
+        default: { return false; }
+    }
+}
+
+} // end anonymous namespace
+
 // can contain additional rows
 // notably pivot changed rows will be added
 std::pair<std::shared_ptr<t_data_table>, std::shared_ptr<t_data_table>>
@@ -339,7 +680,7 @@ t_stree::build_strand_table(const t_data_table& flattened, const t_data_table& d
         piv_scols[pidx] = strands->get_column(piv).get();
     }
 
-    t_uindex aggcolsize = rv.m_aggschema.m_columns.size();
+    t_uindex aggcolsize = rv.m_naggcols;
     std::vector<const t_column*> agg_ccols(aggcolsize);
     std::vector<const t_column*> agg_pcols(aggcolsize);
     std::vector<const t_column*> agg_dcols(aggcolsize);
@@ -367,6 +708,32 @@ t_stree::build_strand_table(const t_data_table& flattened, const t_data_table& d
 
     t_column* spkey = strands->get_column("psp_pkey").get();
 
+    auto mean_accs = get_mean_accumulator_cols(rv, prev, current, *aggs);
+    auto extreme_accs = get_extreme_accumulator_cols(rv, prev, current, *aggs);
+
+    // Mirror the rows `build_strand_table_phase_1` pushes - the current row
+    // if the pivots changed, its delta otherwise, and the reversed previous
+    // row on delete.
+    auto push_phase_1_accs = [&mean_accs, &extreme_accs](t_uindex idx, t_op op,
+                                 bool force_current_row, bool pivots_neq) {
+        if (op == OP_DELETE) {
+            push_mean_accumulators(mean_accs, idx, 0, true);
+            push_extreme_accumulators(extreme_accs, idx, false, true);
+        } else if (pivots_neq || force_current_row) {
+            push_mean_accumulators(mean_accs, idx, 1, false);
+            push_extreme_accumulators(extreme_accs, idx, true, false);
+        } else {
+            push_mean_accumulators(mean_accs, idx, 1, true);
+            push_extreme_accumulators(extreme_accs, idx, true, true);
+        }
+    };
+
+    // Mirror the reversed previous row `build_strand_table_phase_2` pushes.
+    auto push_phase_2_accs = [&mean_accs, &extreme_accs](t_uindex idx) {
+        push_mean_accumulators(mean_accs, idx, 0, true);
+        push_extreme_accumulators(extreme_accs, idx, false, true);
+    };
+
     t_mask msk_prev, msk_curr;
 
     if (config.has_filters()) {
@@ -395,17 +762,20 @@ t_stree::build_strand_table(const t_data_table& flattened, const t_data_table& d
                     aggcolsize, true, piv_ccols, piv_tcols, agg_ccols, agg_dcols, piv_scols,
                     agg_acols, agg_scount, spkey, insert_count, pivots_neq,
                     rv.m_pivot_like_columns);
+                push_phase_1_accs(idx, op, true, pivots_neq);
             } else if (filter_prev && !filter_curr) {
                 // reverse prev row
                 build_strand_table_phase_2(pkey, idx, rv.m_pivsize, strand_count_idx,
                     aggcolsize, piv_pcols, agg_pcols, piv_scols, agg_acols, agg_scount, spkey,
                     insert_count, rv.m_pivot_like_columns);
+                push_phase_2_accs(idx);
             } else if (filter_prev && filter_curr) {
                 // should be handled as normal
                 build_strand_table_phase_1(pkey, op, idx, rv.m_pivsize, strand_count_idx,
                     aggcolsize, false, piv_ccols, piv_tcols, agg_ccols, agg_dcols, piv_scols,
                     agg_acols, agg_scount, spkey, insert_count, pivots_neq,
                     rv.m_pivot_like_columns);
+                push_phase_1_accs(idx, op, false, pivots_neq);
 
                 if (op == OP_DELETE || !pivots_neq) {
                     continue;
@@ -414,6 +784,7 @@ t_stree::build_strand_table(const t_data_table& flattened, const t_data_table& d
                 build_strand_table_phase_2(pkey, idx, rv.m_pivsize, strand_count_idx,
                     aggcolsize, piv_pcols, agg_pcols, piv_scols, agg_acols, agg_scount, spkey,
                     insert_count, rv.m_pivot_like_columns);
+                push_phase_2_accs(idx);
             }
         }
     } else {
@@ -428,6 +799,7 @@ t_stree::build_strand_table(const t_data_table& flattened, const t_data_table& d
                 aggcolsize, false, piv_ccols, piv_tcols, agg_ccols, agg_dcols, piv_scols,
                 agg_acols, agg_scount, spkey, insert_count, pivots_neq,
                 rv.m_pivot_like_columns);
+            push_phase_1_accs(idx, op, false, pivots_neq);
 
             if (op == OP_DELETE || !pivots_neq) {
                 continue;
@@ -436,6 +808,7 @@ t_stree::build_strand_table(const t_data_table& flattened, const t_data_table& d
             build_strand_table_phase_2(pkey, idx, rv.m_pivsize, strand_count_idx, aggcolsize,
                 piv_pcols, agg_pcols, piv_scols, agg_acols, agg_scount, spkey, insert_count,
                 rv.m_pivot_like_columns);
+            push_phase_2_accs(idx);
         }
     }
 
@@ -444,6 +817,8 @@ t_stree::build_strand_table(const t_data_table& flattened, const t_data_table& d
     aggs->reserve(insert_count);
     aggs->set_size(insert_count);
     agg_scount->valid_raw_fill();
+    valid_raw_fill_mean_accumulators(mean_accs);
+    valid_raw_fill_extreme_accumulators(extreme_accs);
     return std::pair<std::shared_ptr<t_data_table>, std::shared_ptr<t_data_table>>(
         strands, aggs);
 }
@@ -482,7 +857,7 @@ t_stree::build_strand_table(const t_data_table& flattened,
         piv_scols[pidx] = strands->get_column(piv).get();
     }
 
-    t_uindex aggcolsize = rv.m_aggschema.m_columns.size();
+    t_uindex aggcolsize = rv.m_naggcols;
     std::vector<const t_column*> agg_fcols(aggcolsize);
     std::vector<t_column*> agg_acols(aggcolsize);
 
@@ -504,6 +879,10 @@ t_stree::build_strand_table(const t_data_table& flattened,
 
     t_column* spkey = strands->get_column("psp_pkey").get();
 
+    // Every row is new, so its contribution is read from `flattened`.
+    auto mean_accs = get_mean_accumulator_cols(rv, flattened, flattened, *aggs);
+    auto extreme_accs = get_extreme_accumulator_cols(rv, flattened, flattened, *aggs);
+
     t_mask msk;
 
     if (config.has_filters()) {
@@ -534,6 +913,8 @@ t_stree::build_strand_table(const t_data_table& flattened,
             }
         }
 
+        push_mean_accumulators(mean_accs, idx, 1, false);
+        push_extreme_accumulators(extreme_accs, idx, true, false);
         agg_scount->push_back<std::int8_t>(1);
         spkey->push_back(pkey);
         ++insert_count;
@@ -544,6 +925,8 @@ t_stree::build_strand_table(const t_data_table& flattened,
     aggs->reserve(insert_count);
     aggs->set_size(insert_count);
     agg_scount->valid_raw_fill();
+    valid_raw_fill_mean_accumulators(mean_accs);
+    valid_raw_fill_extreme_accumulators(extreme_accs);
     return std::pair<std::shared_ptr<t_data_table>, std::shared_ptr<t_data_table>>(
         strands, aggs);
 }
@@ -726,10 +1109,41 @@ t_stree::update_aggs_from_static(const t_dtree_ctx& ctx, const t_gstate& gstate)
     t_agg_update_info agg_update_info;
     t_schema aggschema = m_aggregates->get_schema();
 
+    const t_schema& src_schema = src_aggtable.get_schema();
+
     for (auto colname : aggschema.m_columns) {
+        const t_aggspec& spec = ctx.get_aggspec(colname);
         agg_update_info.m_src.push_back(src_aggtable.get_const_column(colname).get());
         agg_update_info.m_dst.push_back(m_aggregates->get_column(colname).get());
-        agg_update_info.m_aggspecs.push_back(ctx.get_aggspec(colname));
+        agg_update_info.m_aggspecs.push_back(spec);
+
+        const t_column* src_nr = nullptr;
+        const t_column* src_dr = nullptr;
+        std::string nr_colname = spec.get_mean_numerator_colname() + "_sum";
+
+        if (spec.is_incremental_mean() && src_schema.has_column(nr_colname)) {
+            src_nr = src_aggtable.get_const_column(nr_colname).get();
+            src_dr = src_aggtable
+                         .get_const_column(spec.get_mean_denominator_colname() + "_sum")
+                         .get();
+        }
+
+        agg_update_info.m_src_mean_nr.push_back(src_nr);
+        agg_update_info.m_src_mean_dr.push_back(src_dr);
+
+        const t_column* src_in = nullptr;
+        const t_column* src_out = nullptr;
+        std::string in_colname = spec.get_extreme_in_colname() + "_extreme";
+
+        if (spec.is_incremental_extreme() && src_schema.has_column(in_colname)) {
+            src_in = src_aggtable.get_const_column(in_colname).get();
+            src_out = src_aggtable
+                          .get_const_column(spec.get_extreme_out_colname() + "_extreme")
+                          .get();
+        }
+
+        agg_update_info.m_src_extreme_in.push_back(src_in);
+        agg_update_info.m_src_extreme_out.push_back(src_out);
     }
 
     auto is_col_scaled_aggregate = [&](int col_idx) -> bool {
@@ -780,16 +1194,138 @@ t_stree::update_aggs_from_static(const t_dtree_ctx& ctx, const t_gstate& gstate)
         }
     }
 
+    // In lazy mode, non-decomposable aggregates are left for
+    // `refresh_aggregates`, unless a scaled aggregate reads them. Incremental
+    // extremes are updated from the previous value of every node, so they
+    // can't be left stale.
+    std::vector<t_uindex> lazy_cols;
+    if (m_lazy_aggregates) {
+        std::set<t_uindex> scaled_deps;
+        for (t_uindex idx : cols_topo_sorted) {
+            if (is_col_scaled_aggregate(idx)) {
+                scaled_deps.insert(agg_update_info.m_aggspecs[idx].get_agg_one_idx());
+                scaled_deps.insert(agg_update_info.m_aggspecs[idx].get_agg_two_idx());
+            }
+        }
+
+        std::vector<t_uindex> eager_cols;
+        for (t_uindex idx : cols_topo_sorted) {
+            if (agg_update_info.m_aggspecs[idx].is_non_decomposable()
+                && agg_update_info.m_src_extreme_in[idx] == nullptr
+                && scaled_deps.find(idx) == scaled_deps.end()) {
+                lazy_cols.push_back(idx);
+            } else {
+                eager_cols.push_back(idx);
+            }
+        }
+
+        std::swap(cols_topo_sorted, eager_cols);
+
+        m_lazy_info.m_src = std::vector<const t_column*>(col_cnt, nullptr);
+        m_lazy_info.m_dst = agg_update_info.m_dst;
+        m_lazy_info.m_aggspecs = agg_update_info.m_aggspecs;
+        m_lazy_info.m_src_mean_nr = std::vector<const t_column*>(col_cnt, nullptr);
+        m_lazy_info.m_src_mean_dr = std::vector<const t_column*>(col_cnt, nullptr);
+        m_lazy_info.m_src_extreme_in = std::vector<const t_column*>(col_cnt, nullptr);
+        m_lazy_info.m_src_extreme_out = std::vector<const t_column*>(col_cnt, nullptr);
+        m_lazy_info.m_dst_topo_sorted = lazy_cols;
+    }
+
+    // Without deltas to report, sums and counts of the nodes created by this
+    // step are filled a column at a time, in parallel across columns, which
+    // is most of the work of the initial build of a pivot.
+    std::vector<t_tree_unify_rec> fresh_recs;
+    if (!m_features.at(CTX_FEAT_DELTA)) {
+        for (const auto& r : m_tree_unification_records) {
+            if (m_newids.find(r.m_sptidx) != m_newids.end() && node_exists(r.m_sptidx)) {
+                fresh_recs.push_back(r);
+            }
+        }
+    }
+
+    t_agg_update_info fresh_info = agg_update_info;
+    if (!fresh_recs.empty()) {
+        std::vector<t_uindex> fresh_cols = cols_topo_sorted;
+        std::vector<std::uint8_t> done(fresh_cols.size(), 0);
+
+#ifdef PSP_PARALLEL_FOR
+        tbb::parallel_for(0, int(fresh_cols.size()), 1,
+            [&](int idx)
+#else
+        for (t_uindex idx = 0, loop_end = fresh_cols.size(); idx < loop_end; ++idx)
+#endif
+            { done[idx] = update_fresh_aggs(agg_update_info, fresh_cols[idx], fresh_recs); }
+#ifdef PSP_PARALLEL_FOR
+        );
+#endif
+
+        fresh_info.m_dst_topo_sorted.clear();
+        for (t_uindex idx = 0; idx < fresh_cols.size(); ++idx) {
+            if (done[idx]) {
+                m_has_delta = true;
+            } else {
+                fresh_info.m_dst_topo_sorted.push_back(fresh_cols[idx]);
+            }
+        }
+    }
+
     for (const auto& r : m_tree_unification_records) {
         if (!node_exists(r.m_sptidx)) {
             continue;
         }
 
-        update_agg_table(
-            r.m_sptidx, agg_update_info, r.m_daggidx, r.m_saggidx, r.m_nstrands, gstate);
+        bool is_fresh = !fresh_recs.empty() && m_newids.find(r.m_sptidx) != m_newids.end();
+        update_agg_table(r.m_sptidx, is_fresh ? fresh_info : agg_update_info, r.m_daggidx,
+            r.m_saggidx, r.m_nstrands, gstate);
+
+        if (!lazy_cols.empty()) {
+            m_stale_aggs.insert(r.m_sptidx);
+        }
     }
 }
 
+void
+t_stree::set_lazy_aggregates(bool lazy) {
+    m_lazy_aggregates = lazy;
+}
+
+bool
+t_stree::has_stale_aggregates() const {
+    return !m_stale_aggs.empty();
+}
+
+void
+t_stree::refresh_aggregates(const std::vector<t_uindex>& nidxs, const t_gstate& gstate) {
+    for (t_uindex nidx : nidxs) {
+        auto iter = m_stale_aggs.find(nidx);
+        if (iter == m_stale_aggs.end()) {
+            continue;
+        }
+
+        m_stale_aggs.erase(iter);
+
+        if (!node_exists(nidx)) {
+            continue;
+        }
+
+        t_uindex aggidx = get_aggidx(nidx);
+        update_agg_table(nidx, m_lazy_info, aggidx, aggidx, get_node(nidx).m_nstrands, gstate);
+    }
+}
+
+void
+t_stree::refresh_aggregates(t_depth depth, const t_gstate& gstate) {
+    std::vector<t_uindex> nidxs(1, 0);
+    for (t_uindex idx = 0; idx < nidxs.size(); ++idx) {
+        if (get_depth(nidxs[idx]) < depth) {
+            auto children = get_child_idx(nidxs[idx]);
+            nidxs.insert(nidxs.end(), children.begin(), children.end());
+        }
+    }
+
+    refresh_aggregates(nidxs, gstate);
+}
+
 t_uindex
 t_stree::genidx() {
     return m_curidx++;
@@ -889,6 +1425,42 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
                 dst->set_scalar(dst_ridx, new_value);
             } break;
             case AGGTYPE_MEAN: {
+                const t_column* src_nr = info.m_src_mean_nr[idx];
+                const t_column* src_dr = info.m_src_mean_dr[idx];
+
+                std::pair<double, double>* dst_pair
+                    = dst->get_nth<std::pair<double, double>>(dst_ridx);
+
+                old_value.set(dst_pair->first / dst_pair->second);
+
+                if (src_nr != nullptr) {
+                    // New nodes may reuse the storage of a dropped node.
+                    bool is_new = m_newids.find(nidx) != m_newids.end();
+                    double nr = is_new ? 0 : dst_pair->first;
+                    double dr = is_new ? 0 : dst_pair->second;
+                    double dnr = *(src_nr->get_nth<double>(src_ridx));
+                    double ddr = *(src_dr->get_nth<double>(src_ridx));
+
+                    // NaN can't be subtracted out of the numerator once added,
+                    // so recalculate it below in case it is now finite.
+                    if (!std::isnan(nr) && !std::isnan(dnr)) {
+                        nr += dnr;
+                        dr += ddr;
+
+                        // The count is exact, so drop any rounding error left
+                        // in the numerator when the node is emptied.
+                        if (dr == 0) {
+                            nr = 0;
+                        }
+
+                        dst_pair->first = nr;
+                        dst_pair->second = dr;
+                        dst->set_valid(dst_ridx, true);
+                        new_value.set(nr / dr);
+                        break;
+                    }
+                }
+
                 auto pkeys = get_pkeys(nidx);
                 std::vector<double> values;
 
@@ -897,11 +1469,6 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
                 auto nr = std::accumulate(values.begin(), values.end(), double(0));
                 double dr = values.size();
 
-                std::pair<double, double>* dst_pair
-                    = dst->get_nth<std::pair<double, double>>(dst_ridx);
-
-                old_value.set(dst_pair->first / dst_pair->second);
-
                 dst_pair->first = nr;
                 dst_pair->second = dr;
 
@@ -910,10 +1477,36 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
                 new_value.set(nr / dr);
             } break;
             case AGGTYPE_WEIGHTED_MEAN: {
-                auto pkeys = get_pkeys(nidx);
+                const t_column* src_nr = info.m_src_mean_nr[idx];
+                const t_column* src_dr = info.m_src_mean_dr[idx];
+
+                std::pair<double, double>* dst_pair
+                    = dst->get_nth<std::pair<double, double>>(dst_ridx);
+                old_value.set(dst_pair->first / dst_pair->second);
 
                 double nr = 0;
                 double dr = 0;
+
+                if (src_nr != nullptr) {
+                    // NaN values and weights are never accumulated, so the
+                    // accumulators are always finite.
+                    if (m_newids.find(nidx) == m_newids.end()) {
+                        nr = dst_pair->first;
+                        dr = dst_pair->second;
+                    }
+
+                    nr += *(src_nr->get_nth<double>(src_ridx));
+                    dr += *(src_dr->get_nth<double>(src_ridx));
+
+                    dst_pair->first = nr;
+                    dst_pair->second = dr;
+
+                    dst->set_valid(dst_ridx, dr != 0);
+                    new_value.set(nr / dr);
+                    break;
+                }
+
+                auto pkeys = get_pkeys(nidx);
                 std::vector<t_tscalar> values;
                 std::vector<t_tscalar> weights;
 
@@ -932,10 +1525,6 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
                     }
                 }
 
-                std::pair<double, double>* dst_pair
-                    = dst->get_nth<std::pair<double, double>>(dst_ridx);
-                old_value.set(dst_pair->first / dst_pair->second);
-
                 dst_pair->first = nr;
                 dst_pair->second = dr;
 
@@ -1288,6 +1877,63 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
                 if (!skip)
                     dst->set_scalar(dst_ridx, new_value);
             } break;
+            case AGGTYPE_MAX:
+            case AGGTYPE_MIN: {
+                // Unlike the high and low water marks, these are reduced
+                // from the rows under the node, so they follow rows out of a
+                // node when they are removed or expired.
+                old_value.set(dst->get_scalar(dst_ridx));
+                bool is_max = spec.agg() == AGGTYPE_MAX;
+                const t_column* src_in = info.m_src_extreme_in[idx];
+                const t_column* src_out = info.m_src_extreme_out[idx];
+
+                if (src_in != nullptr) {
+                    // New nodes may reuse the storage of a dropped node.
+                    bool is_new = m_newids.find(nidx) != m_newids.end();
+                    t_tscalar prev = is_new ? mknone() : old_value;
+                    t_tscalar in = src_in->get_scalar(src_ridx);
+                    t_tscalar out = src_out->get_scalar(src_ridx);
+                    t_tscalar identity = extreme_identity(in.get_dtype(), is_max);
+
+                    // Only rescan when the current extreme may have left the
+                    // node, or when nothing valid entered an empty one.
+                    if (prev.is_valid()) {
+                        if (is_max ? out < prev : out > prev) {
+                            new_value.set(is_max ? std::max(prev, in) : std::min(prev, in));
+                            dst->set_scalar(dst_ridx, new_value);
+                            break;
+                        }
+                    } else if (in != identity) {
+                        new_value.set(in);
+                        dst->set_scalar(dst_ridx, new_value);
+                        break;
+                    }
+                }
+
+                auto pkeys = get_pkeys(nidx);
+
+                new_value.set(
+                    gstate.reduce<std::function<t_tscalar(std::vector<t_tscalar>&)>>(pkeys,
+                        spec.get_dependencies()[0].name(),
+                        [is_max](std::vector<t_tscalar>& values) {
+                            t_tscalar rval = mknone();
+                            bool found = false;
+                            for (const auto& v : values) {
+                                if (!v.is_valid() || v.is_nan()) {
+                                    continue;
+                                }
+
+                                if (!found || (is_max ? v > rval : v < rval)) {
+                                    rval = v;
+                                    found = true;
+                                }
+                            }
+
+                            return rval;
+                        }));
+
+                dst->set_scalar(dst_ridx, new_value);
+            } break;
             default: { PSP_COMPLAIN_AND_ABORT("Not implemented"); }
         } // end switch
 
@@ -1452,6 +2098,7 @@ t_stree::drop_zero_strands() {
         if (iter->m_depth == lst)
             leaves.push_back(iter->m_idx);
         node_ids.push_back(iter->m_aggidx);
+        m_stale_aggs.erase(iter->m_idx);
     }
 
     clear_aggregates(node_ids);
@@ -1761,6 +2408,7 @@ t_stree::clear_deltas() {
 void
 t_stree::clear() {
     m_nodes->clear();
+    m_stale_aggs.clear();
     clear_deltas();
 }
 
@@ -253,6 +253,28 @@ Table::remove_port(t_uindex port_id) {
     m_gnode->remove_input_port(port_id);
 }
 
+void
+Table::set_expiry(const std::string& colname, std::int64_t window) {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    PSP_VERBOSE_ASSERT(m_gnode_set, "Cannot set expiry on a gnode that does not exist.");
+    m_gnode->set_expiry(colname, window);
+    m_pool->update_expiry_deadline();
+}
+
+t_uindex
+Table::compact_vocabularies() {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    PSP_VERBOSE_ASSERT(m_gnode_set, "Cannot compact a gnode that does not exist.");
+    return m_gnode->compact_vocabularies();
+}
+
+t_uindex
+Table::get_vocab_size(const std::string& colname) const {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    PSP_VERBOSE_ASSERT(m_gnode_set, "Cannot read from a gnode that does not exist.");
+    return m_gnode->get_vocab_size(colname);
+}
+
 void
 Table::calculate_offset(std::uint32_t row_count) {
     m_offset = (m_offset + row_count) % m_limit;
@@ -316,6 +338,12 @@ Table::set_data_types(const std::vector<t_dtype>& data_types) {
     m_data_types = data_types;
 }
 
+void
+Table::set_offset(std::uint32_t offset) {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    m_offset = offset;
+}
+
 void
 Table::validate_columns(const std::vector<std::string>& column_names) {
     if (m_index != "") {
@@ -9,6 +9,7 @@
 
 #include <perspective/first.h>
 #include <perspective/base.h>
+#include <perspective/config.h>
 #include <perspective/filter.h>
 #include <perspective/path.h>
 #include <perspective/sparse_tree.h>
@@ -159,6 +160,30 @@ notify_sparse_tree(std::shared_ptr<t_stree> tree, std::shared_ptr<t_traversal> t
         aggregates, tree_sortby, ctx_sortby, gstate);
 }
 
+std::vector<std::string>
+ctx_get_column_dependencies(const t_config& config) {
+    std::vector<std::string> columns;
+
+    for (const auto& pivot : config.get_pivots()) {
+        columns.push_back(pivot.colname());
+        columns.push_back(config.get_sort_by(pivot.colname()));
+    }
+
+    for (const auto& aggspec : config.get_aggregates()) {
+        for (const auto& dep : aggspec.get_dependencies()) {
+            if (dep.type() == DEPTYPE_COLUMN) {
+                columns.push_back(dep.name());
+            }
+        }
+    }
+
+    for (const auto& fterm : config.get_fterms()) {
+        columns.push_back(fterm.m_colname);
+    }
+
+    return columns;
+}
+
 std::vector<t_path>
 ctx_get_expansion_state(
     std::shared_ptr<const t_stree> tree, std::shared_ptr<const t_traversal> traversal) {
@@ -19,9 +19,14 @@ void
 t_update_task::run() {
     auto work_to_do = m_pool.m_data_remaining.load();
     m_pool.m_data_remaining.store(false);
+    m_pool.record_processed_batch();
 
+    // Walk the gnodes by index, as an update callback may register or
+    // delete a table - a deleted table's gnode is cleared from `m_gnodes`
+    // and must not be touched after the callback returns.
     if (work_to_do) {
-        for (auto g : m_pool.m_gnodes) {
+        for (t_uindex idx = 0; idx < m_pool.m_gnodes.size(); ++idx) {
+            t_gnode* g = m_pool.m_gnodes[idx];
             if (g) {
                 t_uindex num_input_ports = g->num_input_ports();
 
@@ -31,6 +36,9 @@ t_update_task::run() {
                     bool did_notify_context = g->process(port_id);
                     if (did_notify_context) {
                         m_pool.notify_userspace(port_id);
+                        if (m_pool.m_gnodes[idx] != g) {
+                            break;
+                        }
                     }
                     g->clear_output_ports();
                 }
@@ -38,6 +46,22 @@ t_update_task::run() {
         }
     }
 
+    // Expire rows after applying updates, so that a row whose time was just
+    // refreshed is not deleted by a stale entry.
+    for (t_uindex idx = 0; idx < m_pool.m_gnodes.size(); ++idx) {
+        t_gnode* g = m_pool.m_gnodes[idx];
+        if (g && g->expire_rows()) {
+            bool did_notify_context = g->process(0);
+            if (did_notify_context) {
+                m_pool.notify_userspace(0);
+                if (m_pool.m_gnodes[idx] != g) {
+                    continue;
+                }
+            }
+            g->clear_output_ports();
+        }
+    }
+
     m_pool.inc_epoch();
 }
 } // end namespace perspective
@@ -893,6 +893,12 @@ std::thread::id
 View<CTX_T>::get_event_loop_thread_id() const {
     return m_table->get_pool()->get_event_loop_thread_id();
 };
+
+template <typename CTX_T>
+std::shared_ptr<t_pool>
+View<CTX_T>::get_pool() const {
+    return m_table->get_pool();
+}
 #endif
 
 /******************************************************************************
@@ -31,6 +31,7 @@ t_view_config::t_view_config(
     , m_computed_columns(computed_columns)
     , m_row_pivot_depth(-1)
     , m_column_pivot_depth(-1)
+    , m_limit(-1)
     , m_filter_op(filter_op)
     , m_column_only(column_only) {}
 
@@ -124,6 +125,12 @@ t_view_config::set_column_pivot_depth(std::int32_t depth) {
     m_column_pivot_depth = depth;
 }
 
+void
+t_view_config::set_limit(std::int32_t limit) {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    m_limit = limit;
+}
+
 std::vector<std::string>
 t_view_config::get_row_pivots() const {
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
@@ -196,6 +203,12 @@ t_view_config::get_column_pivot_depth() const {
     return m_column_pivot_depth;
 }
 
+std::int32_t
+t_view_config::get_limit() const {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    return m_limit;
+}
+
 // PRIVATE
 void
 t_view_config::fill_aggspecs(std::shared_ptr<t_schema> schema) {
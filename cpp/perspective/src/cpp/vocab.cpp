@@ -10,6 +10,7 @@
 #include <perspective/first.h>
 #include <perspective/vocab.h>
 #include <tsl/hopscotch_set.h>
+#include <cstring>
 
 namespace perspective {
 
@@ -41,7 +42,9 @@ t_vocab::rebuild_map() {
     m_map.clear();
     m_map.reserve((size_t)m_vlenidx);
     for (t_uindex idx = 0; idx < m_vlenidx; ++idx) {
-        m_map[unintern_c(idx)] = idx;
+        const std::pair<t_uindex, t_uindex>* p
+            = m_extents->get_nth<std::pair<t_uindex, t_uindex>>(idx);
+        m_map[t_cchar_span(unintern_c(idx), p->second - p->first - 1)] = idx;
     }
 }
 
@@ -54,7 +57,7 @@ t_vocab::reserve(size_t total_string_size, size_t string_count) {
 
 bool
 t_vocab::string_exists(const char* c, t_uindex& interned) const {
-    auto iter = m_map.find(c);
+    auto iter = m_map.find(t_cchar_span(c, std::strlen(c)));
 
     if (iter == m_map.end())
         return false;
@@ -68,35 +71,107 @@ t_vocab::get_interned(const char* s) {
 #ifdef PSP_COLUMN_VERIFY
     PSP_VERBOSE_ASSERT(s != 0, "Null string");
 #endif
+    return get_interned(s, std::strlen(s));
+}
 
-    t_sidxmap::iterator iter = m_map.find(s);
+t_uindex
+t_vocab::get_interned(const char* s, t_uindex len) {
+#ifdef PSP_COLUMN_VERIFY
+    PSP_VERBOSE_ASSERT(s != 0, "Null string");
+#endif
 
-    t_uindex idx, bidx, eidx;
-    t_uindex len = strlen(s) + 1;
+    t_sidxmap::iterator iter = m_map.find(t_cchar_span(s, len));
 
-    if (iter == m_map.end()) {
-        idx = genidx();
+    if (iter != m_map.end()) {
+        return iter->second;
+    }
 
-        bidx = m_vlendata->size();
-        eidx = bidx + len;
-        const void* obase = m_vlendata->get_nth<const char>(0);
-        const void* oebase = m_extents->get_nth<std::pair<t_uindex, t_uindex>>(0);
-        m_vlendata->push_back(static_cast<const void*>(s), len);
-        m_extents->push_back(std::pair<t_uindex, t_uindex>(bidx, eidx));
-        const void* nbase = m_vlendata->get_nth<const char>(0);
-        const void* nebase = m_extents->get_nth<std::pair<t_uindex, t_uindex>>(0);
-        if ((obase == nbase) && (oebase == nebase)) {
-            m_map[unintern_c(idx)] = idx;
-        } else {
-            rebuild_map();
-        }
+    t_uindex idx = genidx();
+    t_uindex bidx = m_vlendata->size();
+    t_uindex eidx = bidx + len + 1;
+    const void* obase = m_vlendata->get_nth<const char>(0);
+    const void* oebase = m_extents->get_nth<std::pair<t_uindex, t_uindex>>(0);
+    m_vlendata->push_back(static_cast<const void*>(s), len);
+    m_vlendata->push_back(static_cast<char>(0));
+    m_extents->push_back(std::pair<t_uindex, t_uindex>(bidx, eidx));
+    const void* nbase = m_vlendata->get_nth<const char>(0);
+    const void* nebase = m_extents->get_nth<std::pair<t_uindex, t_uindex>>(0);
+    if ((obase == nbase) && (oebase == nebase)) {
+        m_map[t_cchar_span(unintern_c(idx), len)] = idx;
     } else {
-        idx = iter->second;
+        rebuild_map();
     }
 
     return idx;
 }
 
+void
+t_vocab::intern_many(
+    const char* const* strs, const std::uint32_t* lengths, t_uindex n, t_uindex* out) {
+    if (n == 0) {
+        return;
+    }
+
+    out[0] = get_interned(strs[0], lengths[0]);
+
+    for (t_uindex i = 1; i < n; ++i) {
+        // Sorted and low-cardinality columns repeat the previous value often
+        // enough that comparing against it first skips most hash probes.
+        if (lengths[i] == lengths[i - 1]
+            && (strs[i] == strs[i - 1]
+                || std::memcmp(strs[i], strs[i - 1], lengths[i]) == 0)) {
+            out[i] = out[i - 1];
+        } else {
+            out[i] = get_interned(strs[i], lengths[i]);
+        }
+    }
+}
+
+t_uindex
+t_vocab::compact(const std::vector<bool>& used, std::vector<t_uindex>& remap) {
+    PSP_VERBOSE_ASSERT(used.size() == m_vlenidx, "Mismatched vocabulary mask");
+
+    remap.assign(m_vlenidx, 0);
+
+    // Ids are assigned in insertion order, so extents are monotonic and every
+    // surviving string can be moved down without overlapping a later one.
+    t_uindex new_idx = 0;
+    t_uindex write_offset = 0;
+
+    for (t_uindex idx = 0; idx < m_vlenidx; ++idx) {
+        if (!used[idx]) {
+            continue;
+        }
+
+        std::pair<t_uindex, t_uindex>* extent
+            = m_extents->get_nth<std::pair<t_uindex, t_uindex>>(idx);
+        t_uindex len = extent->second - extent->first;
+
+        if (write_offset != extent->first) {
+            std::memmove(
+                m_vlendata->get_ptr(write_offset), m_vlendata->get_ptr(extent->first), len);
+        }
+
+        *(m_extents->get_nth<std::pair<t_uindex, t_uindex>>(new_idx))
+            = std::pair<t_uindex, t_uindex>(write_offset, write_offset + len);
+
+        remap[idx] = new_idx;
+        write_offset += len;
+        ++new_idx;
+    }
+
+    t_uindex dropped = m_vlenidx - new_idx;
+
+    if (dropped > 0) {
+        m_vlendata->set_size(write_offset);
+        m_extents->set_size(new_idx * sizeof(std::pair<t_uindex, t_uindex>));
+        m_vlenidx = new_idx;
+        rebuild_map();
+    }
+
+    return dropped;
+}
+
 t_uindex
 t_vocab::genidx() {
     return m_vlenidx++;
@@ -113,7 +188,7 @@ t_vocab::init(bool from_recipe) {
 
 t_uindex
 t_vocab::get_interned(const std::string& s) {
-    return get_interned(s.c_str());
+    return get_interned(s.c_str(), s.size());
 }
 
 void
@@ -121,7 +196,7 @@ t_vocab::verify() const {
     std::map<t_uindex, const char*> rlookup;
 
     for (const auto& kv : m_map) {
-        rlookup[kv.second] = kv.first;
+        rlookup[kv.second] = kv.first.m_data;
     }
 
     tsl::hopscotch_set<std::string> seen;
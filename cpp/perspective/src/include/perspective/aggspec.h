@@ -75,6 +75,16 @@ public:
 
     bool is_non_delta() const;
 
+    bool is_non_decomposable() const;
+
+    bool is_incremental_mean() const;
+    std::string get_mean_numerator_colname() const;
+    std::string get_mean_denominator_colname() const;
+
+    bool is_incremental_extreme() const;
+    std::string get_extreme_in_colname() const;
+    std::string get_extreme_out_colname() const;
+
     std::string get_first_depname() const;
 
 private:
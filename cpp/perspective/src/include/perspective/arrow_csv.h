@@ -10,6 +10,7 @@
 #pragma once
 #include <unordered_map>
 #include <arrow/io/memory.h>
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 
 namespace perspective {
@@ -26,5 +27,40 @@ namespace apachearrow {
         std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
             schema);
 
+#ifndef PSP_ENABLE_WASM
+    /**
+     * @brief Memory-map the CSV file at `path` and read it into an arrow
+     * table, parsing and converting blocks in parallel.
+     *
+     * @param path
+     */
+    std::shared_ptr<::arrow::Table> csvFileToTable(const std::string& path,
+        bool is_update,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema);
+
+    /**
+     * @brief Parse and convert the CSV in `input` in parallel, typed by
+     * `schema`, and open a reader of its record batches, one per block.
+     *
+     * @param input
+     */
+    std::shared_ptr<arrow::RecordBatchReader> csvToBatchReader(
+        std::shared_ptr<arrow::io::InputStream> input,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema);
+
+    /**
+     * @brief Memory-map the CSV file at `path` and open a reader of its
+     * record batches, see `csvToBatchReader`.
+     *
+     * @param path
+     */
+    std::shared_ptr<arrow::RecordBatchReader> csvFileToBatchReader(
+        const std::string& path,
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>&
+            schema);
+#endif
+
 } // namespace apachearrow
 } // namespace perspective
\ No newline at end of file
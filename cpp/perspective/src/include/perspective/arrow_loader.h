@@ -13,6 +13,7 @@
 #include <perspective/date.h>
 #include <perspective/exports.h>
 #include <perspective/data_table.h>
+#include <perspective/data_loader.h>
 #include <perspective/last.h>
 #include <chrono>
 #include <date/date.h>
@@ -25,10 +26,14 @@
 #include <perspective/arrow_csv.h>
 #endif
 
+#if ARROW_VERSION_MAJOR >= 1 && !defined(PSP_ENABLE_WASM)
+#include <arrow/c/abi.h>
+#endif
+
 namespace perspective {
 namespace apachearrow {
 
-    class PERSPECTIVE_EXPORT ArrowLoader {
+    class PERSPECTIVE_EXPORT ArrowLoader : public t_data_loader {
     public:
         ArrowLoader();
         ~ArrowLoader();
@@ -38,42 +43,119 @@ namespace apachearrow {
          * 
          * @param ptr 
          */
-        void initialize(uintptr_t ptr, std::uint32_t);
+        void initialize(uintptr_t ptr, std::int64_t length);
 
-#ifdef PSP_ENABLE_WASM
+#if ARROW_VERSION_MAJOR >= 1
         /**
          * @brief Initialize the arrow loader with a CSV.
          * 
          * @param ptr 
          */
         void init_csv(std::string& csv, bool is_update, std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& schema);
+
+#ifndef PSP_ENABLE_WASM
+        /**
+         * @brief Initialize the arrow loader with the CSV file at `path`,
+         * which is memory-mapped rather than read into memory.
+         * 
+         * @param path 
+         */
+        void init_csv_file(const std::string& path, bool is_update, std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& schema);
+
+        /**
+         * @brief Parse a CSV update typed by `schema` in parallel, and load
+         * it one record batch at a time, see `next_batch`.
+         * 
+         * @param csv 
+         */
+        void init_csv_batches(const std::string& csv, std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& schema);
+
+        /**
+         * @brief Parse the CSV file at `path` through a memory map, see
+         * `init_csv_batches`.
+         * 
+         * @param path 
+         */
+        void init_csv_file_batches(const std::string& path, std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>& schema);
 #endif
 
         /**
-         * @brief Given an arrow binary and a data table, load the arrow into
-         * Perspective. If updating an existing table, use the `input_schema`
-         * of the table and respect it as much as possible.
+         * @brief Open an arrow stream or file binary for incremental loading,
+         * reading only its schema. Each call to `next_batch` then loads a
+         * single record batch, so the binary is never materialized as one
+         * table. `ptr` must outlive the loader.
          * 
-         * @param tbl
-         * @param input_schema
-         * @param index
-         * @param offset
-         * @param limit
-         * @param is_update 
+         * @param ptr 
+         * @param length 
          */
-        void fill_table(
-            t_data_table& tbl,
-            const t_schema& input_schema,
-            const std::string& index,
-            std::uint32_t offset,
-            std::uint32_t limit, 
-            bool is_update);
+        void init_batches(uintptr_t ptr, std::int64_t length);
+
+#ifndef PSP_ENABLE_WASM
+        /**
+         * @brief Open the arrow stream or file at `path` for incremental
+         * loading through a memory map.
+         * 
+         * @param path 
+         */
+        void init_batches_file(const std::string& path);
+
+        /**
+         * @brief Whether the file at `path` begins with the magic bytes of an
+         * arrow file or stream, rather than being e.g. a CSV.
+         * 
+         * @param path 
+         */
+        static bool is_arrow_file(const std::string& path);
+
+        /**
+         * @brief Load the record batches of an arrow C stream, e.g. exported
+         * by `pyarrow` while it decodes a Parquet, one at a time, see
+         * `next_batch`. The loader takes ownership of `stream`, so its
+         * batches are never serialized to an arrow binary.
+         * 
+         * @param stream 
+         */
+        void init_batches_c_stream(struct ArrowArrayStream* stream);
+#endif
+
+        /**
+         * @brief Load the next record batch opened by `init_batches`,
+         * `init_csv_batches` or `init_batches_c_stream`, which
+         * replaces the previous batch. Returns false once every batch has
+         * been read, leaving an empty table with the stream's schema.
+         * 
+         * @return bool
+         */
+        bool next_batch();
+#endif
 
         std::vector<std::string> names() const;
         std::vector<t_dtype> types() const;
         std::uint32_t row_count() const;
 
+    protected:
+        /**
+         * @brief The arrow's own columns and types, skipping columns that
+         * are not in `input_schema`.
+         */
+        std::vector<t_loader_column> get_loader_columns(const t_schema& input_schema) const override;
+
+        void fill_column(t_data_table& tbl, std::shared_ptr<t_column> col,
+            const std::string& name, const t_loader_column& source, bool is_update) override;
+
+        // Arrow columns are copied without calling into the binding.
+        bool is_fill_parallel() const override;
+
     private:
+        /**
+         * @brief Read column names and types from `schema`.
+         */
+        void init_names_and_types(const arrow::Schema& schema);
+
+#if ARROW_VERSION_MAJOR >= 1
+        void init_batches_source(std::shared_ptr<arrow::io::RandomAccessFile> source);
+#endif
+
         void fill_column(
             t_data_table& tbl, 
             std::shared_ptr<t_column> col,
@@ -84,10 +166,28 @@ namespace apachearrow {
             bool is_update);
 
         std::shared_ptr<arrow::Table> m_table;
+
+        // Incremental loading state, see `init_batches`.
+        std::shared_ptr<arrow::io::RandomAccessFile> m_batch_source;
+        std::shared_ptr<arrow::RecordBatchReader> m_stream_reader;
+        std::shared_ptr<arrow::ipc::RecordBatchFileReader> m_file_reader;
+        std::shared_ptr<arrow::Schema> m_batch_schema;
+        int m_batch_idx;
+
         std::vector<std::string> m_names;
         std::vector<t_dtype> m_types;
     };
 
+    /**
+     * @brief Map each column of a Perspective schema to the arrow type its
+     * values should be converted to when reading a CSV update.
+     * 
+     * @param schema
+     * @return std::unordered_map<std::string, std::shared_ptr<arrow::DataType>> 
+     */
+    std::unordered_map<std::string, std::shared_ptr<arrow::DataType>>
+    get_csv_column_types(const t_schema& schema);
+
     template <typename T, typename V>
     void
     iter_col_copy(
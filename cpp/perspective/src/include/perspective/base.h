@@ -39,6 +39,12 @@ namespace perspective {
 const std::int32_t PSP_VERSION = 67;
 const double PSP_TABLE_GROW_RATIO = 1.3;
 
+// A master table string column is compacted once its vocabulary holds more
+// than `PSP_VOCAB_COMPACT_RATIO` strings per live row, and at least
+// `PSP_VOCAB_COMPACT_MIN_SIZE` strings in total.
+const double PSP_VOCAB_COMPACT_RATIO = 2.0;
+const std::uint64_t PSP_VOCAB_COMPACT_MIN_SIZE = 4096;
+
 #ifdef WIN32
 #define PSP_RESTRICT __restrict
 #define PSP_THR_LOCAL __declspec(thread)
@@ -324,7 +330,9 @@ enum t_aggtype {
     AGGTYPE_DISTINCT_COUNT,
     AGGTYPE_DISTINCT_LEAF,
     AGGTYPE_PCT_SUM_PARENT,
-    AGGTYPE_PCT_SUM_GRAND_TOTAL
+    AGGTYPE_PCT_SUM_GRAND_TOTAL,
+    AGGTYPE_MAX,
+    AGGTYPE_MIN
 };
 
 PERSPECTIVE_EXPORT t_aggtype str_to_aggtype(const std::string& str);
@@ -503,6 +511,31 @@ struct t_cchar_umap_hash {
     }
 };
 
+// A non-owning pointer and length, so that strings with a known length can
+// be hashed and compared without rescanning for the NUL terminator.
+struct t_cchar_span {
+    t_cchar_span(const char* data, t_uindex size)
+        : m_data(data)
+        , m_size(size) {}
+
+    const char* m_data;
+    t_uindex m_size;
+};
+
+struct t_cchar_span_cmp {
+    inline bool
+    operator()(const t_cchar_span& x, const t_cchar_span& y) const {
+        return x.m_size == y.m_size && std::memcmp(x.m_data, y.m_data, x.m_size) == 0;
+    }
+};
+
+struct t_cchar_span_hash {
+    inline t_uindex
+    operator()(const t_cchar_span& s) const {
+        return boost::hash_range(s.m_data, s.m_data + s.m_size);
+    }
+};
+
 bool is_internal_colname(const std::string& c);
 
 bool is_deterministic_sized(t_dtype dtype);
@@ -131,6 +131,11 @@ public:
 
     t_uindex get_vlenidx() const;
 
+    // Rebuild the vocabulary of a string column so that it only holds
+    // strings referenced by valid rows, remapping the stored ids in place.
+    // Returns the number of strings dropped.
+    t_uindex compact_vocabulary();
+
     const char* unintern_c(t_uindex idx) const;
 
     // Internal apis
@@ -63,6 +63,10 @@ void clear_deltas();
 
 void reset_step_state();
 
+// Fills `columns` with the table columns this context reads, or returns
+// false if it depends on every column.
+bool get_column_dependencies(std::vector<std::string>& columns) const;
+
 void disable();
 
 void enable();
@@ -47,6 +47,13 @@ public:
     using t_ctxbase<t_ctx1>::get_data;
 
 private:
+    /**
+     * @brief Compute the stale aggregates of every node in the traversal,
+     * as the tree only computes non-decomposable aggregates for nodes
+     * which are shown.
+     */
+    void refresh_visible_aggregates();
+
     std::shared_ptr<t_traversal> m_traversal;
     std::shared_ptr<t_stree> m_tree;
     std::vector<t_sortspec> m_sortby;
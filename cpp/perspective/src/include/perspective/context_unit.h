@@ -72,6 +72,9 @@ public:
 
     void step_end();
 
+    // Always false, as a unit context shows every column of the table.
+    bool get_column_dependencies(std::vector<std::string>& columns) const;
+
     std::string repr() const;
 
     void init();
@@ -113,6 +116,12 @@ public:
 
     const tsl::hopscotch_set<t_tscalar>& get_delta_pkeys() const;
 
+    /**
+     * @brief The primary keys of the rows `get_row_delta` returns, in the
+     * same order, without clearing the delta.
+     */
+    std::vector<t_tscalar> get_row_delta_pkeys() const;
+
     // Unity api
     std::vector<t_tscalar> unity_get_row_data(t_uindex idx) const;
     std::vector<t_tscalar> unity_get_row_path(t_uindex idx) const;
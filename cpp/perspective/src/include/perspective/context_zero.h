@@ -41,6 +41,15 @@ public:
     void sort_by();
     std::vector<t_sortspec> get_sort_by() const;
 
+    /**
+     * @brief Keep only the first `limit` rows of a sorted context, and a
+     * reserve of rows behind them, see `t_ftrav::get_capacity`. Must be
+     * called before the context is registered.
+     *
+     * @param limit
+     */
+    void set_limit(t_index limit);
+
     std::pair<t_tscalar, t_tscalar> get_min_max(const std::string& colname) const;
 
     using t_ctxbase<t_ctx0>::get_data;
@@ -74,6 +83,13 @@ protected:
 
     void add_delta_pkey(t_tscalar pkey);
 
+    /**
+     * @brief Refill a bounded traversal from every row of the `t_gstate`
+     * which passes the context's filters, once its reserve is exhausted and
+     * rows that were dropped from it may have to replace rows that left it.
+     */
+    void rescan();
+
 private:
     std::shared_ptr<t_ftrav> m_traversal;
     std::shared_ptr<t_zcdeltas> m_deltas;
@@ -0,0 +1,142 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2019, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#pragma once
+#include <perspective/first.h>
+#include <perspective/base.h>
+#include <perspective/exports.h>
+#include <perspective/data_table.h>
+#include <perspective/schema.h>
+
+namespace perspective {
+
+/**
+ * @brief A column of a loader's source dataset, which is filled into the
+ * `t_data_table` column of the same name.
+ *
+ * - m_name: the column's name in the source, which is `__INDEX__` for an
+ * explicit index.
+ * - m_cidx: the column's position in the source.
+ * - m_type: the `t_dtype` the column is filled as.
+ */
+struct PERSPECTIVE_EXPORT t_loader_column {
+    std::string m_name;
+    std::int32_t m_cidx;
+    t_dtype m_type;
+};
+
+/**
+ * @class t_data_loader
+ *
+ * @brief The interface shared by every format Perspective can ingest -
+ * Arrow, CSV (through Arrow), numpy, and Python/Javascript columns and rows.
+ *
+ * A loader only implements `fill_column`, which converts one source column
+ * into a `t_column`. `fill_table` handles the rest of loading uniformly:
+ * which columns are filled, the explicit `__INDEX__` column, the implicit
+ * `(ridx + offset) % limit` primary key, and the `psp_pkey`/`psp_okey`
+ * columns.
+ *
+ * The rules every loader shares while filling a column - how a null is
+ * written, and how a column is promoted when a value does not fit its
+ * inferred type - live here as `fill_null` and `promote_column`. Reading
+ * and converting values stays with each loader, as it depends on how the
+ * source represents them.
+ */
+class PERSPECTIVE_EXPORT t_data_loader {
+public:
+    virtual ~t_data_loader();
+
+    /**
+     * @brief Fill `tbl` from the loader's source. If updating an existing
+     * table, `input_schema` is the table's input schema.
+     *
+     * @param tbl
+     * @param input_schema
+     * @param index the name of the index column, or an empty string to use
+     * the implicit index.
+     * @param offset
+     * @param limit
+     * @param is_update
+     */
+    void fill_table(t_data_table& tbl, const t_schema& input_schema, const std::string& index,
+        std::uint32_t offset, std::uint32_t limit, bool is_update);
+
+    /**
+     * @brief Add `psp_pkey` and `psp_okey` to `tbl`, with the row number
+     * `(ridx + offset) % limit` as the primary key of each row.
+     *
+     * @param tbl
+     * @param offset
+     * @param limit
+     */
+    static void fill_implicit_index(t_data_table& tbl, std::uint32_t offset, std::uint32_t limit);
+
+    /**
+     * @brief Write a null into row `ridx` of `col`. An update unsets the
+     * row, so that the null overwrites the row's current value, whereas a
+     * new table clears it.
+     *
+     * @param col
+     * @param ridx
+     * @param is_update
+     */
+    static void fill_null(t_column& col, t_uindex ridx, bool is_update);
+
+    /**
+     * @brief Promote the column `name` of `tbl` to `type`, after reading
+     * row `ridx` showed that its inferred type cannot hold the source's
+     * values. If `fill` is true, rows before `ridx` are converted to the
+     * new type, otherwise they are refilled by the caller.
+     *
+     * @param tbl
+     * @param name
+     * @param type
+     * @param ridx
+     * @param fill
+     * @return std::shared_ptr<t_column> the promoted column, which replaces
+     * the column the caller was filling.
+     */
+    static std::shared_ptr<t_column> promote_column(t_data_table& tbl, const std::string& name,
+        t_dtype type, std::int32_t ridx, bool fill);
+
+protected:
+    /**
+     * @brief The source columns that `fill_table` should fill. By default,
+     * every column of `input_schema`, in order, with its schema type.
+     *
+     * @param input_schema
+     * @return std::vector<t_loader_column>
+     */
+    virtual std::vector<t_loader_column> get_loader_columns(const t_schema& input_schema) const;
+
+    /**
+     * @brief Fill `col`, which is `name` in the table (`psp_pkey` for the
+     * `__INDEX__` column), from the source column `source`.
+     *
+     * @param tbl
+     * @param col
+     * @param name
+     * @param source
+     * @param is_update
+     */
+    virtual void fill_column(t_data_table& tbl, std::shared_ptr<t_column> col,
+        const std::string& name, const t_loader_column& source, bool is_update) = 0;
+
+    /**
+     * @brief Whether `fill_column` may be called for several columns at
+     * once. Loaders that only write into the column they are filling, and
+     * never call back into the binding language, should return true.
+     *
+     * @return bool
+     */
+    virtual bool is_fill_parallel() const;
+};
+
+} // end namespace perspective
@@ -101,11 +101,18 @@ public:
     // Only increment capacity
     void reserve(t_uindex nelems);
 
+    // Only increment capacity of the columns in `colnames`
+    void reserve(t_uindex nelems, const std::vector<std::string>& colnames);
+
     // Increment capacity and size
     void extend(t_uindex nelems);
 
     void set_size(t_uindex size);
 
+    // Set the size of the table and of the columns in `colnames`, and leave
+    // the other columns empty
+    void set_size(t_uindex size, const std::vector<std::string>& colnames);
+
     t_column* _get_column(const std::string& colname);
 
     std::shared_ptr<t_data_table> flatten() const;
@@ -50,6 +50,9 @@ private:
     std::vector<t_aggspec> m_aggspecs;
     std::shared_ptr<t_data_table> m_aggregates;
     bool m_init;
+    // the number of aggspecs of the context, which precede the strand count
+    // and accumulator aggspecs added by the constructor.
+    t_uindex m_ncontext_aggspecs;
     std::map<std::string, t_index> m_aggspecmap;
 };
 
@@ -54,6 +54,38 @@ public:
     void sort_by(std::shared_ptr<const t_gstate> gstate, const t_config& config,
         const std::vector<t_sortspec>& sortby);
 
+    /**
+     * @brief Replace the rows of the traversal with `pkeys`, in sort order.
+     * If the traversal is bounded, only the first `limit` rows are kept.
+     */
+    void select_rows(std::shared_ptr<const t_gstate> gstate, const t_config& config,
+        const std::vector<t_tscalar>& pkeys);
+
+    /**
+     * @brief Keep only the first `limit` rows in sort order, or all rows if
+     * `limit` is negative. Only applies to a sorted traversal, and must be
+     * set before rows are added.
+     */
+    void set_limit(t_index limit);
+    t_index get_limit() const;
+    bool is_bounded() const;
+
+    /**
+     * @brief The number of rows a bounded traversal keeps in sort order -
+     * its first `limit` rows, which it exposes, followed by a reserve that
+     * replaces them as they are deleted or sorted past, so the context is
+     * only rescanned once the reserve is exhausted.
+     */
+    t_index get_capacity() const;
+
+    /**
+     * @brief Whether a row left out of a bounded traversal may belong in
+     * its first `limit` rows after the last `step_end`, which only happens
+     * once its reserve is exhausted, in which case the context should
+     * `select_rows` again.
+     */
+    bool needs_rescan() const;
+
     t_index size() const;
 
     void get_row_indices(const tsl::hopscotch_set<t_tscalar>& pkeys,
@@ -104,6 +136,15 @@ private:
     std::vector<t_sortspec> m_sortby;
     std::shared_ptr<std::vector<t_mselem>> m_index;
     t_symtable m_symtable;
+
+    t_index m_limit;
+
+    // Whether rows of a bounded traversal were left out of `m_index`. Every
+    // such row sorts after `m_cutoff`, unless it was updated since. Only the
+    // first `m_limit` rows of `m_index` are exposed, see `get_capacity`.
+    bool m_truncated;
+    t_mselem m_cutoff;
+    bool m_needs_rescan;
 };
 
 } // end namespace perspective
@@ -32,6 +32,8 @@
 #include <tbb/tbb.h>
 #endif
 #include <chrono>
+#include <queue>
+#include <set>
 
 namespace perspective {
 
@@ -68,6 +70,14 @@ class t_ctx_grouped_pkey;
  */
 struct PERSPECTIVE_EXPORT t_process_table_result {
     std::shared_ptr<t_data_table> m_flattened_data_table;
+    // Whether every row of `m_flattened_data_table` is an insert of a new
+    // primary key, in which case no transitional tables were built.
+    bool m_is_append;
+    // Whether any row inserts a new primary key or removes an existing one.
+    bool m_rows_added_or_removed;
+    // The columns written to rows that already existed, and the computed
+    // columns which depend on them.
+    std::set<std::string> m_changed_columns;
     bool m_should_notify_userspace;
 };
 class PERSPECTIVE_EXPORT t_gnode {
@@ -179,6 +189,25 @@ public:
 
     t_uindex mapping_size() const;
 
+    /**
+     * @brief Compact the vocabulary of every string column in the gnode
+     * state, returning the number of strings dropped - see
+     * `t_gstate::compact_vocabularies`.
+     *
+     * @return t_uindex
+     */
+    t_uindex compact_vocabularies();
+
+    /**
+     * @brief The number of strings interned by the string column `colname`
+     * of the gnode state. Compaction always keeps id 0, which null rows
+     * point at.
+     *
+     * @param colname
+     * @return t_uindex
+     */
+    t_uindex get_vocab_size(const std::string& colname) const;
+
     // helper function for JS interface
     void promote_column(const std::string& name, t_dtype new_type);
 
@@ -192,6 +221,42 @@ public:
     void pprint() const;
     std::string repr() const;
 
+    /**
+     * @brief Expire rows from the gnode state once the value in their
+     * `colname` column is older than `window` milliseconds, which turns the
+     * table into a sliding time window. `colname` must be a `datetime` or
+     * integer column containing milliseconds since epoch. A `window` of 0
+     * disables expiry.
+     *
+     * @param colname
+     * @param window
+     */
+    void set_expiry(const std::string& colname, std::int64_t window);
+
+    bool has_expiry() const;
+
+    /**
+     * @brief The time, in milliseconds since epoch, from which the oldest
+     * entry in the expiry queue is due to be expired by `expire_rows`, or
+     * -1 if the queue is empty.
+     *
+     * @return std::int64_t
+     */
+    std::int64_t get_expiry_deadline() const;
+
+    /**
+     * @brief If expiry is enabled, send an `OP_DELETE` for each row in the
+     * state whose time column has aged out of the window to input port 0,
+     * and return whether any rows were queued for removal. Rows are popped
+     * off of a min-heap ordered by time, so the cost of each call is
+     * proportional to the number of rows expired and not the size of the
+     * table.
+     *
+     * @return bool
+     */
+    bool expire_rows();
+    bool expire_rows(std::int64_t now);
+
 #ifdef PSP_ENABLE_PYTHON
     void set_event_loop_thread_id(std::thread::id id);
 #endif
@@ -232,10 +297,10 @@ protected:
     void set_ctx_state(void* ptr);
 
     bool have_context(const std::string& name) const;
-    void notify_contexts(const t_data_table& flattened);
+    void notify_contexts(const t_process_table_result& result);
 
     template <typename CTX_T>
-    void notify_context(const t_data_table& flattened, const t_ctx_handle& ctxh);
+    void notify_context(const t_process_table_result& result, const t_ctx_handle& ctxh);
 
     template <typename CTX_T>
     void notify_context(CTX_T* ctx, const t_data_table& flattened, const t_data_table& delta,
@@ -309,6 +374,39 @@ protected:
     void _compute_all_columns(
         std::vector<std::shared_ptr<t_data_table>> tables);
 
+    /**
+     * @brief For each `t_data_table` in tables, apply computations for the
+     * computed columns registered with the gnode that are in `column_names`.
+     * 
+     * @param tables 
+     * @param column_names 
+     */
+    void _compute_columns(
+        std::vector<std::shared_ptr<t_data_table>> tables,
+        const std::vector<std::string>& column_names);
+
+    /**
+     * @brief Returns the columns of the output schema and the computed
+     * columns that a registered context reads from the delta, prev, current
+     * or transitions tables, i.e. filter columns, and the pivot, sort and
+     * aggregate columns of tree contexts, plus any object columns.
+     * 
+     * @return std::vector<std::string> 
+     */
+    std::vector<std::string> _get_transitional_column_names() const;
+
+    /**
+     * @brief Returns the columns of the output schema that `flattened` writes
+     * to rows which already exist, and the computed columns which depend on
+     * them.
+     * 
+     * @param flattened 
+     * @param lookup 
+     * @return std::set<std::string> 
+     */
+    std::set<std::string> _get_changed_columns(
+        const t_data_table& flattened, const std::vector<t_rlookup>& lookup) const;
+
     /**
      * @brief Add all valid computed columns to `table` with the specified
      * `dtype`. Used when a column needs to be present for future operations,
@@ -364,6 +462,14 @@ private:
      */
     t_process_table_result _process_table(t_uindex port_id);
 
+    /**
+     * @brief Push the time column value of each row inserted by `flattened`
+     * onto the expiry queue, keyed by the row's index in the master table.
+     *
+     * @param flattened
+     */
+    void _track_expiry(const t_data_table& flattened);
+
     t_gnode_processing_mode m_mode;
     t_gnode_type m_gnode_type;
 
@@ -396,24 +502,67 @@ private:
     std::function<void()> m_pool_cleanup;
     bool m_was_updated;
 
+    // Sliding time-window expiry - a min-heap of (time, master row index)
+    // pairs. Entries are validated against the master table when popped, so
+    // rows that were updated or removed since being pushed are skipped.
+    typedef std::pair<std::int64_t, t_uindex> t_expiry_entry;
+    std::string m_expiry_column;
+    std::int64_t m_expiry_window;
+    std::priority_queue<t_expiry_entry, std::vector<t_expiry_entry>,
+        std::greater<t_expiry_entry>>
+        m_expiry_queue;
+
 #ifdef PSP_ENABLE_PYTHON
     std::thread::id m_event_loop_thread_id;
 #endif
 };
 
 /**
- * @brief Given a t_data_table and a context handler, construct the t_tables relating to delta
- * calculation and notify the context with the constructed tables.
+ * @brief Given the result of `_process_table` and a context handler, construct
+ * the t_tables relating to delta calculation and notify the context with the
+ * constructed tables.
  *
  * @tparam CTX_T
- * @param flattened
+ * @param result
  * @param ctxh
  */
 template <typename CTX_T>
 void
-t_gnode::notify_context(const t_data_table& flattened, const t_ctx_handle& ctxh) {
+t_gnode::notify_context(const t_process_table_result& result, const t_ctx_handle& ctxh) {
     CTX_T* ctx = ctxh.get<CTX_T>();
-    // These tables are guaranteed to have all computed columns.
+    const t_data_table& flattened = *(result.m_flattened_data_table);
+
+    // Rows that are all new are added from `flattened` alone, as the
+    // transitional tables were not built for them.
+    if (result.m_is_append) {
+        ctx->step_begin();
+        ctx->notify(flattened);
+        ctx->step_end();
+        return;
+    }
+
+    // An update which only changes columns the context does not read leaves
+    // it as it was, so only reset its step state.
+    std::vector<std::string> dependencies;
+    if (!result.m_rows_added_or_removed && ctx->get_column_dependencies(dependencies)) {
+        bool is_changed = false;
+        for (const auto& colname : dependencies) {
+            if (result.m_changed_columns.find(colname) != result.m_changed_columns.end()) {
+                is_changed = true;
+                break;
+            }
+        }
+
+        if (!is_changed) {
+            ctx->step_begin();
+            return;
+        }
+    }
+
+    // delta, prev, current and transitions only hold the columns from
+    // `_get_transitional_column_names()` - those read by a context, the
+    // inputs of any computed column read, and object columns. The other
+    // columns are empty. existed has every row.
     const t_data_table& delta = *(m_oports[PSP_PORT_DELTA]->get_table().get());
     const t_data_table& prev = *(m_oports[PSP_PORT_PREV]->get_table().get());
     const t_data_table& current = *(m_oports[PSP_PORT_CURRENT]->get_table().get());
@@ -92,6 +92,15 @@ public:
         const std::vector<t_uindex>& master_table_indexes,
         t_uindex num_rows);
 
+    /**
+     * @brief Compact the vocabulary of every string column in the master
+     * table, dropping strings which are no longer referenced by a live row.
+     * Returns the total number of strings dropped.
+     *
+     * @return t_uindex
+     */
+    t_uindex compact_vocabularies();
+
     t_tscalar read_by_pkey(
         const std::string& colname, t_tscalar& pkey) const;
 
@@ -284,6 +293,14 @@ protected:
      */
     t_mask get_cpp_mask() const;
 
+    /**
+     * @brief Compact `column`'s vocabulary if deletes and overwrites have
+     * left it mostly holding strings no live row references.
+     *
+     * @param column
+     */
+    void _maybe_compact_vocabulary(t_column* column) const;
+
     void _mark_deleted(t_uindex idx);
     bool has_pkey(t_tscalar pkey) const;
     t_dtype get_pkey_dtype() const;
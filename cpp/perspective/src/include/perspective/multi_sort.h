@@ -151,6 +151,39 @@ cmp_mselem(const t_mselem* a, const t_mselem* b, const std::vector<t_sorttype>&
     return cmp_mselem(*a, *b, sort_order);
 }
 
+class t_column;
+
+// Fixed-width sort keys for a set of rows, two words per sort column, built
+// column-wise from the columns being sorted on. Comparing the words of two
+// rows in order as unsigned integers orders them as `cmp_mselem` would - the
+// sort order, NaN placement and magnitude of `_ABS` sorts are encoded in the
+// words.
+struct PERSPECTIVE_EXPORT t_sort_keys {
+    t_sort_keys(t_uindex nrows, const std::vector<t_sorttype>& sort_order);
+
+    static bool is_encodable(t_dtype dtype);
+
+    // Encode sort column `cidx` of row `idx` from `col[ridxs[idx]]`.
+    void encode_column(t_uindex cidx, const t_column& col, const std::vector<t_uindex>& ridxs);
+
+    const std::uint64_t* get(t_uindex idx) const;
+
+    t_uindex m_nwords;
+    std::vector<t_sorttype> m_sort_order;
+    std::vector<std::uint64_t> m_keys;
+};
+
+// Sorts the indices of `elems` by their `t_sort_keys`, resolving the ties
+// `cmp_mselem` breaks by pkey from the elements themselves.
+struct PERSPECTIVE_EXPORT t_sort_key_sorter {
+    t_sort_key_sorter(const t_sort_keys& keys, const std::vector<t_mselem>& elems);
+
+    bool operator()(t_uindex a, t_uindex b) const;
+
+    const t_sort_keys& m_keys;
+    const std::vector<t_mselem>& m_elems;
+};
+
 // Helper for sorting taking multiple sort specifications
 // into account
 struct PERSPECTIVE_EXPORT t_multisorter {
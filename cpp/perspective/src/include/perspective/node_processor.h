@@ -16,26 +16,57 @@
 #include <perspective/comparators.h>
 #include <perspective/dense_nodes.h>
 #include <perspective/node_processor_types.h>
-#include <perspective/partition.h>
 #include <perspective/mask.h>
 #include <csignal>
 #include <cmath>
+#include <cstring>
 #include <map>
+#include <utility>
+#include <vector>
+#include <tsl/hopscotch_map.h>
+#ifdef PSP_PARALLEL_FOR
+#include <tbb/parallel_for.h>
+#endif
 
 namespace perspective {
 
+// Leaves are grouped in chunks of this many rows, which are grouped and
+// scattered in parallel.
+const t_uindex PSP_PIVOT_CHUNK_SIZE = 65536;
+
+// A cell's raw data and status, which identify its value without boxing it.
+typedef std::pair<std::uint64_t, std::uint8_t> t_pivot_key;
+
+struct t_pivot_key_hash {
+    inline std::size_t
+    operator()(const t_pivot_key& key) const {
+        std::uint64_t h = (key.first ^ (std::uint64_t(key.second) << 56)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>(h ^ (h >> 32));
+    }
+};
+
 template <int DTYPE_T>
 struct t_pivot_processor {
-    typedef t_chunk_value_span<t_tscalar> t_spans;
-    typedef std::vector<t_spans> t_spanvec;
-    typedef std::vector<t_spanvec> t_spanvvec;
     typedef std::map<t_tscalar, t_uindex, t_comparator<t_tscalar, DTYPE_T>> t_map;
+    typedef tsl::hopscotch_map<t_pivot_key, t_uindex, t_pivot_key_hash> t_keymap;
+
+    // The children of a node - their values in order and their leaf counts.
+    struct t_children {
+        std::vector<t_tscalar> m_values;
+        std::vector<t_uindex> m_counts;
+    };
 
-    // For now we dont do any inter node
-    // parallelism. this should be trivial
-    // to fix in the future.
+    // Pivots every node in [nbidx, neidx) on `data`, appending the children
+    // and their values. Sibling nodes are pivoted in parallel, as are chunks
+    // of a large node's leaves.
     t_uindex operator()(const t_column* data, std::vector<t_dense_tnode>* nodes,
         t_column* values, t_column* leaves, t_uindex nbidx, t_uindex neidx, const t_mask* mask);
+
+    // Partitions the leaves [cbidx, ceidx) by value into `lcopy`. Leaves are
+    // grouped by their raw data, and only the distinct values are boxed and
+    // ordered.
+    void pivot_node(const t_column* data, const t_uindex* leaves, t_uindex* lcopy,
+        t_uindex cbidx, t_uindex ceidx, t_children& out) const;
 };
 
 template <int DTYPE_T>
@@ -51,78 +82,182 @@ t_pivot_processor<DTYPE_T>::operator()(const t_column* data, std::vector<t_dense
     t_uindex* leaves_ptr = leaves->get_nth<t_uindex>(0);
     t_uindex* lcopy_ptr = lcopy.get_nth<t_uindex>(0);
     t_uindex lvl_nidx = neidx;
-    t_uindex offset = 0;
+
+    std::vector<t_children> children(neidx - nbidx);
+
+#ifdef PSP_PARALLEL_FOR
+    tbb::parallel_for(0, int(neidx - nbidx), 1,
+        [&](int pidx)
+#else
+    for (t_uindex pidx = 0, loop_end = neidx - nbidx; pidx < loop_end; ++pidx)
+#endif
+        {
+            const t_dense_tnode& pnode = (*nodes)[nbidx + pidx];
+            pivot_node(data, leaves_ptr, lcopy_ptr, pnode.m_flidx,
+                pnode.m_flidx + pnode.m_nleaves, children[pidx]);
+        }
+#ifdef PSP_PARALLEL_FOR
+    );
+#endif
 
     for (t_uindex nidx = nbidx; nidx < neidx; ++nidx) {
+        const t_children& nchildren = children[nidx - nbidx];
         t_dense_tnode* pnode = &nodes->at(nidx);
-        t_uindex cbidx = pnode->m_flidx;
-        t_uindex ceidx = pnode->m_flidx + pnode->m_nleaves;
         t_uindex parent_idx = pnode->m_idx;
-        t_spanvvec spanvec;
-        {
-            t_spanvec spans;
-            partition(data, leaves, cbidx, ceidx, spans);
-            spanvec.push_back(spans);
+        t_uindex offset = pnode->m_flidx;
+
+        // Update current node
+        pnode->m_fcidx = lvl_nidx;
+        pnode->m_nchild = nchildren.m_values.size();
+
+        for (t_uindex cidx = 0, loop_end = nchildren.m_values.size(); cidx < loop_end;
+             ++cidx) {
+            t_uindex count = nchildren.m_counts[cidx];
+            nodes->push_back({lvl_nidx, parent_idx, 0, 0, offset, count});
+            lvl_nidx += 1;
+            offset += count;
+            values->push_back<t_tscalar>(nchildren.m_values[cidx]);
         }
+    }
+
+    t_lstore* llstore = leaves->_get_data_lstore();
+
+    memcpy(leaves_ptr, lcopy_ptr, llstore->size());
+
+    return lvl_nidx;
+}
+
+template <int DTYPE_T>
+void
+t_pivot_processor<DTYPE_T>::pivot_node(const t_column* data, const t_uindex* leaves,
+    t_uindex* lcopy, t_uindex cbidx, t_uindex ceidx, t_children& out) const {
+    t_uindex nleaves = ceidx - cbidx;
+    if (nleaves == 0)
+        return;
+
+    const std::uint8_t* base = data->get_nth<std::uint8_t>(0);
+    t_uindex elem_size = get_dtype_size(data->get_dtype());
+    bool status_enabled = data->is_status_enabled();
+
+    auto get_key = [&](t_uindex ridx) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, base + ridx * elem_size, elem_size);
+        std::uint8_t status = status_enabled ? *(data->get_nth_status(ridx)) : STATUS_VALID;
+        return t_pivot_key(bits, status);
+    };
+
+    // Group each chunk's leaves by key, recording the local group of each
+    // leaf and the first row of each group.
+    t_uindex nchunks = (nleaves + PSP_PIVOT_CHUNK_SIZE - 1) / PSP_PIVOT_CHUNK_SIZE;
+    std::vector<t_uindex> groups(nleaves);
+    std::vector<std::vector<t_uindex>> chunk_rows(nchunks);
 
-        // map value to number of rows with value
-        t_map globcount((t_comparator<t_tscalar, DTYPE_T>()));
-
-        for (t_index idx = 0, loop_end = spanvec.size(); idx < loop_end; ++idx) {
-            const t_spanvec& sp = spanvec[idx];
-            for (t_uindex spidx = 0, sp_loop_end = sp.size(); spidx < sp_loop_end; ++spidx) {
-                const t_spans& vsp = sp[spidx];
-                auto miter = globcount.find(vsp.m_value);
-                if (miter == globcount.end()) {
-                    globcount[vsp.m_value] = vsp.m_eidx - vsp.m_bidx;
-                } else {
-                    miter->second = miter->second + vsp.m_eidx - vsp.m_bidx;
+#ifdef PSP_PARALLEL_FOR
+    tbb::parallel_for(0, int(nchunks), 1,
+        [&](int chunk)
+#else
+    for (t_uindex chunk = 0; chunk < nchunks; ++chunk)
+#endif
+        {
+            t_uindex bidx = chunk * PSP_PIVOT_CHUNK_SIZE;
+            t_uindex eidx = std::min(bidx + PSP_PIVOT_CHUNK_SIZE, nleaves);
+            t_keymap keymap;
+            std::vector<t_uindex>& rows = chunk_rows[chunk];
+
+            for (t_uindex idx = bidx; idx < eidx; ++idx) {
+                t_uindex ridx = leaves[cbidx + idx];
+                auto inserted = keymap.insert(std::make_pair(get_key(ridx), rows.size()));
+                if (inserted.second) {
+                    rows.push_back(ridx);
                 }
+                groups[idx] = inserted.first->second;
             }
         }
+#ifdef PSP_PARALLEL_FOR
+    );
+#endif
 
-        // map value to leaf offset
-        t_map globcursor((t_comparator<t_tscalar, DTYPE_T>()));
+    // Order the distinct values. Keys which differ but compare equivalent,
+    // i.e. -0 and 0, share a child as they would in `t_map`.
+    t_map order((t_comparator<t_tscalar, DTYPE_T>()));
+    std::vector<std::vector<t_tscalar>> chunk_values(nchunks);
 
-        for (typename t_map::const_iterator miter = globcount.begin(),
-                                            loop_end = globcount.end();
-             miter != loop_end; ++miter) {
-            globcursor[miter->first] = offset;
-            offset += miter->second;
+    for (t_uindex chunk = 0; chunk < nchunks; ++chunk) {
+        for (t_uindex ridx : chunk_rows[chunk]) {
+            t_tscalar value = data->get_scalar(ridx);
+            order.insert(std::make_pair(value, 0));
+            chunk_values[chunk].push_back(value);
         }
+    }
 
-        auto running_cursor = globcursor;
-        for (t_index idx = 0, loop_end = spanvec.size(); idx < loop_end; ++idx) {
-            const t_spanvec& sp = spanvec[idx];
-            for (t_index spidx = 0, sp_loop_end = sp.size(); spidx < sp_loop_end; ++spidx) {
-                const auto& cvs = sp[spidx];
-                t_uindex voff = running_cursor[cvs.m_value];
-                memcpy(lcopy_ptr + voff, leaves_ptr + cvs.m_bidx,
-                    sizeof(t_uindex) * (cvs.m_eidx - cvs.m_bidx));
+    t_uindex nchild = 0;
+    for (auto& kv : order) {
+        kv.second = nchild++;
+        out.m_values.push_back(kv.first);
+    }
 
-                running_cursor[cvs.m_value] = voff + cvs.m_eidx - cvs.m_bidx;
-            }
+    std::vector<std::vector<t_uindex>> chunk_children(nchunks);
+    for (t_uindex chunk = 0; chunk < nchunks; ++chunk) {
+        for (const t_tscalar& value : chunk_values[chunk]) {
+            chunk_children[chunk].push_back(order.find(value)->second);
         }
+    }
 
-        // Update current node
-        pnode->m_fcidx = lvl_nidx;
-        pnode->m_nchild = globcount.size();
+    // Scatter the leaves by child, in parallel only if the per chunk counts
+    // are no larger than the leaves themselves.
+    t_uindex nscatter = nchunks * nchild <= nleaves ? nchunks : 1;
+    t_uindex scatter_size = (nleaves + nscatter - 1) / nscatter;
+    std::vector<t_uindex> counts(nscatter * nchild, 0);
 
-        for (typename t_map::const_iterator miter = globcursor.begin(),
-                                            loop_end = globcursor.end();
-             miter != loop_end; ++miter) {
-            nodes->push_back(
-                {lvl_nidx, parent_idx, 0, 0, miter->second, globcount[miter->first]});
-            lvl_nidx += 1;
-            values->push_back<t_tscalar>(miter->first);
-        }
-    }
+    auto child_of = [&](t_uindex idx) {
+        return chunk_children[idx / PSP_PIVOT_CHUNK_SIZE][groups[idx]];
+    };
 
-    t_lstore* llstore = leaves->_get_data_lstore();
+#ifdef PSP_PARALLEL_FOR
+    tbb::parallel_for(0, int(nscatter), 1,
+        [&](int sidx)
+#else
+    for (t_uindex sidx = 0; sidx < nscatter; ++sidx)
+#endif
+        {
+            t_uindex* scounts = counts.data() + sidx * nchild;
+            t_uindex eidx = std::min((sidx + 1) * scatter_size, nleaves);
+            for (t_uindex idx = sidx * scatter_size; idx < eidx; ++idx) {
+                ++scounts[child_of(idx)];
+            }
+        }
+#ifdef PSP_PARALLEL_FOR
+    );
+#endif
 
-    memcpy(leaves_ptr, lcopy_ptr, llstore->size());
+    out.m_counts.assign(nchild, 0);
+    t_uindex offset = cbidx;
+    for (t_uindex cidx = 0; cidx < nchild; ++cidx) {
+        for (t_uindex sidx = 0; sidx < nscatter; ++sidx) {
+            t_uindex& count = counts[sidx * nchild + cidx];
+            out.m_counts[cidx] += count;
+            t_uindex cursor = offset;
+            offset += count;
+            count = cursor;
+        }
+    }
 
-    return lvl_nidx;
+#ifdef PSP_PARALLEL_FOR
+    tbb::parallel_for(0, int(nscatter), 1,
+        [&](int sidx)
+#else
+    for (t_uindex sidx = 0; sidx < nscatter; ++sidx)
+#endif
+        {
+            t_uindex* cursors = counts.data() + sidx * nchild;
+            t_uindex eidx = std::min((sidx + 1) * scatter_size, nleaves);
+            for (t_uindex idx = sidx * scatter_size; idx < eidx; ++idx) {
+                lcopy[cursors[child_of(idx)]++] = leaves[cbidx + idx];
+            }
+        }
+#ifdef PSP_PARALLEL_FOR
+    );
+#endif
 }
 
 } // end namespace perspective
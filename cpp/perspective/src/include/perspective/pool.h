@@ -14,9 +14,11 @@
 #include <perspective/exports.h>
 #include <mutex>
 #include <atomic>
+#include <memory>
 
 #ifdef PSP_ENABLE_PYTHON
 #include <thread>
+#include <condition_variable>
 #endif
 
 #if defined PSP_ENABLE_WASM
@@ -37,9 +39,27 @@ struct PERSPECTIVE_EXPORT t_updctx {
     std::string m_ctx;
 };
 
+/**
+ * @brief Counters of the updates sent to a pool, and of how they were
+ * coalesced when processed.
+ */
+struct PERSPECTIVE_EXPORT t_pool_metrics {
+    t_pool_metrics();
+
+    // Updates sent since the pool was last processed, and their rows.
+    t_uindex m_queued_batches;
+    t_uindex m_queued_rows;
+
+    // Totals over every `_process` which had updates to apply.
+    t_uindex m_num_processed;
+    t_uindex m_batches_processed;
+    t_uindex m_rows_processed;
+    t_uindex m_max_batch_rows;
+};
+
 class t_update_task;
 
-class PERSPECTIVE_EXPORT t_pool {
+class PERSPECTIVE_EXPORT t_pool : public std::enable_shared_from_this<t_pool> {
     friend class t_update_task;
     typedef std::pair<t_uindex, std::string> t_ctx_id;
 
@@ -64,6 +84,43 @@ public:
 #ifdef PSP_ENABLE_PYTHON
     void set_event_loop();
     std::thread::id get_event_loop_thread_id() const;
+
+    /**
+     * @brief The lock serializing engine work on this pool between Python
+     * threads, which run it with the GIL released.
+     *
+     * @return std::recursive_mutex&
+     */
+    std::recursive_mutex& get_engine_mutex();
+
+    /**
+     * @brief Start a thread, owned by the pool, which processes updates as
+     * they are sent instead of waiting for `_process` to be called. Once
+     * woken by a `send`, the thread waits `window_ms` milliseconds so that
+     * updates arriving close together are processed as one, or less if
+     * `max_rows` rows are queued first. The pool must be owned by a
+     * `std::shared_ptr`, which the thread holds while it processes.
+     *
+     * @param window_ms
+     * @param max_rows the number of queued rows which ends the window early,
+     * or 0 for no limit.
+     */
+    void start_processing_thread(t_uindex window_ms, t_uindex max_rows);
+
+    /**
+     * @brief Stop and join the processing thread, if one is running. Must be
+     * called without the GIL held, as the thread may be waiting on it to
+     * notify userspace. Called from an update callback, the thread is only
+     * stopped, and exits once the callback returns.
+     */
+    void stop_processing_thread();
+
+    bool has_processing_thread() const;
+
+    /**
+     * @brief Whether the calling thread is this pool's processing thread.
+     */
+    bool on_processing_thread() const;
 #endif
 
     /**
@@ -90,6 +147,23 @@ public:
     std::vector<t_stree*> get_trees();
 
     bool get_data_remaining() const;
+
+    /**
+     * @brief The earliest time, in milliseconds since epoch, at which a row
+     * of one of the pool's gnodes is due to expire, or -1 if none is. Until
+     * then, `_process` skips expiry when no updates are queued.
+     *
+     * @return std::int64_t
+     */
+    std::int64_t get_expiry_deadline() const;
+
+    /**
+     * @brief Recompute `get_expiry_deadline` from the gnodes' expiry queues,
+     * and wake the processing thread to wait for it. Must be called with the
+     * engine lock held, after a gnode's expiry changes.
+     */
+    void update_expiry_deadline();
+    t_pool_metrics get_metrics();
     std::vector<t_updctx> get_contexts_last_updated();
     std::string repr() const;
 
@@ -113,8 +187,20 @@ protected:
 private:
 #ifdef PSP_ENABLE_PYTHON
     std::thread::id m_event_loop_thread_id;
+    std::recursive_mutex m_engine_mtx;
+
+    void _processing_loop(std::weak_ptr<t_pool> weak_self);
+
+    std::thread m_processing_thread;
+    std::condition_variable m_processing_cv;
+    std::atomic<bool> m_processing_stop;
+    std::atomic<t_uindex> m_processing_window;
+    std::atomic<t_uindex> m_processing_max_rows;
 #endif
+    void record_processed_batch();
+
     std::mutex m_mtx;
+    t_pool_metrics m_metrics;
     std::vector<t_gnode*> m_gnodes;
 
 #if defined PSP_ENABLE_WASM || defined PSP_ENABLE_PYTHON
@@ -123,6 +209,7 @@ private:
     std::atomic_flag m_run;
     std::atomic<bool> m_data_remaining;
     std::atomic<t_uindex> m_sleep;
+    std::atomic<std::int64_t> m_expiry_deadline;
     std::atomic<t_uindex> m_epoch;
 };
 
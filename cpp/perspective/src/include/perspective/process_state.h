@@ -30,14 +30,16 @@ struct t_process_state {
     void clear_transitional_data_tables();
 
     /**
-     * @brief Reserve `size` elements for each transitional table in the state.
+     * @brief Reserve `size` elements for each transitional table in the state,
+     * only in the columns of `m_column_names`.
      * 
      * @param size 
      */
     void reserve_transitional_data_tables(t_uindex size);
 
     /**
-     * @brief For each transitional table in the state, set its size to `size`.
+     * @brief For each transitional table in the state, set its size to `size`
+     * - columns not in `m_column_names` are left empty.
      * 
      * @param size 
      */
@@ -51,6 +53,10 @@ struct t_process_state {
     std::shared_ptr<t_data_table> m_transitions_data_table;
     std::shared_ptr<t_data_table> m_existed_data_table;
 
+    // The columns of the delta, prev, current and transitions tables that
+    // are read by at least one context.
+    std::vector<std::string> m_column_names;
+
     std::vector<t_rlookup> m_lookup;
     std::vector<t_uindex> m_col_translation;
     std::vector<t_uindex> m_added_offset;
@@ -12,15 +12,43 @@
 
 #ifdef PSP_ENABLE_PYTHON
 #include <thread>
+#include <mutex>
 
 namespace perspective {
 
+class t_pool;
+
+/**
+ * @brief Releases the GIL for the lifetime of the object, if the calling
+ * thread holds it, so that other Python threads can run while the engine
+ * works. If an event loop has been set, aborts when called from Python on
+ * any other thread.
+ *
+ * When constructed from a `t_pool`, also holds the pool's engine lock, taken
+ * after the GIL is released so that a thread never waits on it while holding
+ * the GIL. Python threads can then work on different tables in parallel,
+ * while work on the same table is serialized.
+ */
 class PERSPECTIVE_EXPORT PerspectiveScopedGILRelease {
     public:
         PerspectiveScopedGILRelease(std::thread::id event_loop_thread_id);
+        PerspectiveScopedGILRelease(t_pool& pool);
         ~PerspectiveScopedGILRelease();
     private:
         PyThreadState* m_thread_state;
+        std::recursive_mutex* m_engine_mtx;
+};
+
+/**
+ * @brief Acquires the GIL for the lifetime of the object, for calling back
+ * into Python from engine code that runs with the GIL released.
+ */
+class PERSPECTIVE_EXPORT PerspectiveScopedGILAcquire {
+    public:
+        PerspectiveScopedGILAcquire();
+        ~PerspectiveScopedGILAcquire();
+    private:
+        PyGILState_STATE m_state;
 };
 
 
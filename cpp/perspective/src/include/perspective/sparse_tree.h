@@ -63,11 +63,35 @@ struct by_idx_lfidx {};
 
 PERSPECTIVE_EXPORT t_tscalar get_dominant(std::vector<t_tscalar>& values);
 
+// The strand table columns accumulating the (numerator, denominator) of an
+// incremental mean aggregate.
+struct t_mean_accumulator {
+    t_aggtype m_agg;
+    std::string m_value_colname;
+    std::string m_weight_colname;
+    std::string m_nr_colname;
+    std::string m_dr_colname;
+};
+
+// The strand table columns holding the extreme value entering and leaving a
+// node for each row of an incremental max or min aggregate.
+struct t_extreme_accumulator {
+    t_aggtype m_agg;
+    std::string m_value_colname;
+    std::string m_in_colname;
+    std::string m_out_colname;
+};
+
 struct t_build_strand_table_common_rval {
     t_schema m_flattened_schema;
     t_schema m_strand_schema;
     t_schema m_aggschema;
     t_uindex m_npivotlike;
+    // the number of leading `m_aggschema` columns, i.e. the dependencies and
+    // `psp_strand_count`, which precede the mean and extreme accumulators.
+    t_uindex m_naggcols;
+    std::vector<t_mean_accumulator> m_mean_accumulators;
+    std::vector<t_extreme_accumulator> m_extreme_accumulators;
     std::vector<std::string> m_pivot_like_columns;
     t_uindex m_pivsize;
 };
@@ -116,6 +140,16 @@ struct PERSPECTIVE_EXPORT t_agg_update_info {
     std::vector<t_column*> m_dst;
     std::vector<t_aggspec> m_aggspecs;
 
+    // the summed accumulator deltas of each incremental mean aggregate, or
+    // null for other aggregates.
+    std::vector<const t_column*> m_src_mean_nr;
+    std::vector<const t_column*> m_src_mean_dr;
+
+    // the extremes of the values entering and leaving each node for each
+    // incremental max or min aggregate, or null for other aggregates.
+    std::vector<const t_column*> m_src_extreme_in;
+    std::vector<const t_column*> m_src_extreme_out;
+
     std::vector<t_uindex> m_dst_topo_sorted;
 };
 
@@ -180,6 +214,20 @@ public:
     void update_shape_from_static(const t_dtree_ctx& ctx);
     void update_aggs_from_static(const t_dtree_ctx& ctx, const t_gstate& gstate);
 
+    /**
+     * If `lazy`, non-decomposable aggregates such as median or distinct
+     * count are not computed when a node is updated. The node is marked
+     * stale instead, and its aggregates are computed by `refresh_aggregates`
+     * once it is shown, e.g. when its parent is expanded.
+     */
+    void set_lazy_aggregates(bool lazy);
+    bool has_stale_aggregates() const;
+
+    // Compute the stale aggregates of `nidxs`, or of every node at or above
+    // `depth`.
+    void refresh_aggregates(const std::vector<t_uindex>& nidxs, const t_gstate& gstate);
+    void refresh_aggregates(t_depth depth, const t_gstate& gstate);
+
     t_uindex size() const;
 
     t_uindex get_num_children(t_uindex idx) const;
@@ -316,6 +364,11 @@ private:
     t_symtable m_symtable;
     bool m_has_delta;
     std::string m_grand_agg_str;
+    bool m_lazy_aggregates;
+    std::set<t_uindex> m_stale_aggs;
+
+    // the non-decomposable aggregates left for `refresh_aggregates`
+    t_agg_update_info m_lazy_info;
 };
 
 
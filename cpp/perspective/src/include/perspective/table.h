@@ -143,6 +143,35 @@ public:
      */
     void remove_port(t_uindex port_id);
 
+    /**
+     * @brief Expire rows whose value in `colname` is more than `window`
+     * units older than the current time, where time columns are measured in
+     * milliseconds. Expired rows are removed on the next call to `process`.
+     * A `window` of 0 disables expiry.
+     *
+     * @param colname a datetime or integer column
+     * @param window
+     */
+    void set_expiry(const std::string& colname, std::int64_t window);
+
+    /**
+     * @brief Drop the strings which are no longer referenced by a row of
+     * the Table, i.e. those only held by deleted or overwritten rows.
+     * Returns the number of strings dropped.
+     *
+     * @return t_uindex
+     */
+    t_uindex compact_vocabularies();
+
+    /**
+     * @brief The number of strings interned by the string column `colname`.
+     * Compaction always keeps id 0, which null rows point at.
+     *
+     * @param colname
+     * @return t_uindex
+     */
+    t_uindex get_vocab_size(const std::string& colname) const;
+
     /**
      * @brief The offset determines where we begin to write data into the Table. 
      * Using `m_offset`, `m_limit`, and the length of the dataset, calculate the new position at which we write data.
@@ -165,6 +194,15 @@ public:
     void set_column_names(const std::vector<std::string>& column_names);
     void set_data_types(const std::vector<t_dtype>& data_types);
 
+    /**
+     * @brief Set the position at which the next update is written, i.e. to
+     * restore the offset of another `Table` whose rows were copied in order
+     * of their primary keys.
+     *
+     * @param offset
+     */
+    void set_offset(std::uint32_t offset);
+
 private:
     /**
      * @brief Make sure that the table does not have an explicit index AND an implicit index (with the `__INDEX__` column in data).
@@ -71,6 +71,13 @@ ctx_set_expansion_state(CONTEXT_T& ctx, t_header header, std::shared_ptr<t_stree
     }
 }
 
+/**
+ * @brief Returns the table columns a tree context with `config` reads: its
+ * pivot, sort-by, aggregate and filter columns.
+ */
+PERSPECTIVE_EXPORT std::vector<std::string> ctx_get_column_dependencies(
+    const t_config& config);
+
 PERSPECTIVE_EXPORT std::vector<t_path> ctx_get_expansion_state(
     std::shared_ptr<const t_stree> tree, std::shared_ptr<const t_traversal> traversal);
 
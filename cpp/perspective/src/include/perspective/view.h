@@ -237,6 +237,7 @@ public:
     bool is_column_only() const;
 #ifdef PSP_ENABLE_PYTHON
     std::thread::id get_event_loop_thread_id() const;
+    std::shared_ptr<t_pool> get_pool() const;
 #endif
 
 private:
@@ -81,6 +81,14 @@ public:
     void set_row_pivot_depth(std::int32_t depth);
     void set_column_pivot_depth(std::int32_t depth);
 
+    /**
+     * @brief Set the maximum number of rows a sorted, flat view should
+     * keep, i.e. for "top N" views.
+     *
+     * @param limit
+     */
+    void set_limit(std::int32_t limit);
+
     std::vector<std::string> get_row_pivots() const;
 
     std::vector<std::string> get_column_pivots() const;
@@ -104,6 +112,8 @@ public:
     std::int32_t get_row_pivot_depth() const;
     std::int32_t get_column_pivot_depth() const;
 
+    std::int32_t get_limit() const;
+
 private:
     bool m_init;
 
@@ -190,6 +200,14 @@ private:
     std::int32_t m_row_pivot_depth;
     std::int32_t m_column_pivot_depth;
 
+    /**
+     * @brief If specified, the maximum number of rows in a sorted 0-sided
+     * view. Only the first `m_limit` rows in sort order are materialized.
+     *
+     * Defaults to -1, which does not limit the view.
+     */
+    std::int32_t m_limit;
+
     /**
      * @brief the `t_filter_op` used to return data in the case of multiple filters being applied.
      *
@@ -22,7 +22,7 @@
 namespace perspective {
 
 class PERSPECTIVE_EXPORT t_vocab {
-    typedef tsl::hopscotch_map<const char*, t_uindex, t_cchar_umap_hash, t_cchar_umap_cmp>
+    typedef tsl::hopscotch_map<t_cchar_span, t_uindex, t_cchar_span_hash, t_cchar_span_cmp>
         t_sidxmap;
 
 public:
@@ -46,6 +46,20 @@ public:
 
     t_uindex get_interned(const std::string& s);
     t_uindex get_interned(const char* s);
+    t_uindex get_interned(const char* s, t_uindex len);
+
+    /**
+     * @brief Intern `n` strings of known length in one pass, writing the id
+     * of each into `out`. Strings do not need to be NUL-terminated, and runs
+     * of repeated strings are resolved without probing the map.
+     *
+     * @param strs
+     * @param lengths
+     * @param n
+     * @param out
+     */
+    void intern_many(const char* const* strs, const std::uint32_t* lengths, t_uindex n,
+        t_uindex* out);
     void copy_vocabulary(const t_vocab& other);
     const char* unintern_c(t_uindex idx) const;
 
@@ -53,6 +67,11 @@ public:
 
     void reserve(size_t total_string_size, size_t string_count);
 
+    // Drop every string whose id is not marked in `used`, moving the
+    // survivors down in place. `remap` is filled with the new id for each
+    // surviving old id. Returns the number of strings dropped.
+    t_uindex compact(const std::vector<bool>& used, std::vector<t_uindex>& remap);
+
 protected:
     // vlen interface
     t_uindex genidx();
@@ -62,10 +81,10 @@ private:
     t_uindex m_vlenidx;
     // varlen
 
-    // Maps a char* to its encoded id
-    // Does not own the char* stored in
-    // it. value is a t_uindex that maps
-    // into m_extents
+    // Maps a char* and its length to its
+    // encoded id. Does not own the char*
+    // stored in it. value is a t_uindex
+    // that maps into m_extents
     t_sidxmap m_map;
 
     // Stores the vlen as is. for string
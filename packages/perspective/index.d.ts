@@ -37,8 +37,10 @@ declare module "@finos/perspective" {
         LAST = "last",
         HIGH = "high",
         LOW = "low",
+        MAX = "max",
         MEAN = "mean",
         MEDIAN = "median",
+        MIN = "min",
         PCT_SUM_PARENT = "pct sum parent",
         PCT_SUM_TOTAL = "pct sum grand total",
         SUM = "sum",
@@ -108,6 +110,8 @@ declare module "@finos/perspective" {
     export type TableOptions = {
         index?: string;
         limit?: number;
+        expire_column?: string;
+        expire_after?: number;
     };
 
     export type ViewConfig = {
@@ -20,7 +20,7 @@ export const CONFIG_ALIASES = {
     sorts: "sort"
 };
 
-export const CONFIG_VALID_KEYS = ["viewport", "row_pivots", "column_pivots", "aggregates", "columns", "filter", "sort", "computed_columns", "row_pivot_depth", "filter_op"];
+export const CONFIG_VALID_KEYS = ["viewport", "row_pivots", "column_pivots", "aggregates", "columns", "filter", "sort", "computed_columns", "row_pivot_depth", "filter_op", "limit"];
 
 const NUMBER_AGGREGATES = [
     "any",
@@ -34,8 +34,10 @@ const NUMBER_AGGREGATES = [
     "last",
     "high",
     "low",
+    "max",
     "mean",
     "median",
+    "min",
     "pct sum parent",
     "pct sum grand total",
     "sum",
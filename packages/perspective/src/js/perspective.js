@@ -58,6 +58,7 @@ export default function(Module) {
         if (pool) {
             pool._process();
             _remove_process(table_id);
+            _set_expiry_timer(pool, table_id);
         }
     }
 
@@ -65,6 +66,31 @@ export default function(Module) {
         delete _POOL_DEBOUNCES[table_id];
     }
 
+    let _EXPIRY_TIMERS = {};
+
+    /**
+     * Process the table again when its earliest row is due to expire, so a
+     * table with `expire_column` expires rows without waiting for an update.
+     *
+     * @private
+     */
+    function _set_expiry_timer(pool, table_id) {
+        _remove_expiry_timer(table_id);
+        const deadline = __MODULE__.get_pool_expiry_deadline(pool);
+        if (deadline >= 0) {
+            _EXPIRY_TIMERS[table_id] = setTimeout(() => {
+                delete _EXPIRY_TIMERS[table_id];
+                pool._process();
+                _set_expiry_timer(pool, table_id);
+            }, Math.max(0, deadline - Date.now()));
+        }
+    }
+
+    function _remove_expiry_timer(table_id) {
+        clearTimeout(_EXPIRY_TIMERS[table_id]);
+        delete _EXPIRY_TIMERS[table_id];
+    }
+
     function memory_usage() {
         const mem = performance.memory ? JSON.parse(JSON.stringify(performance.memory, ["totalJSHeapSize", "usedJSHeapSize", "jsHeapSizeLimit"])) : process.memoryUsage();
         mem.wasmHeap = __MODULE__.HEAP8.length;
@@ -114,6 +140,7 @@ export default function(Module) {
             _set_process(pool, table_id);
         } else {
             pool._process();
+            _set_expiry_timer(pool, table_id);
         }
 
         return _Table;
@@ -1020,6 +1047,7 @@ export default function(Module) {
         this.filter_op = config.filter_op || "and";
         this.row_pivot_depth = config.row_pivot_depth;
         this.column_pivot_depth = config.column_pivot_depth;
+        this.limit = config.limit;
     }
 
     /**
@@ -1185,6 +1213,7 @@ export default function(Module) {
             throw `Cannot delete Table as it still has ${this.views.length} registered View(s).`;
         }
         _remove_process(this.get_id());
+        _remove_expiry_timer(this.get_id());
         this._Table.unregister_gnode(this.gnode_id);
         this._Table.delete();
 
@@ -1392,6 +1421,8 @@ export default function(Module) {
      * apply. A sort configuration is an array of 2 elements: A column name, and
      * a sort direction, which are: "none", "asc", "desc", "col asc", "col
      * desc", "asc abs", "desc abs", "col asc abs", "col desc abs".
+     * @param {number} [config.limit] The maximum number of rows of a sorted
+     * view without pivots; only the first `limit` rows in sort order are kept.
      *
      * @example
      * const view = await table.view({
@@ -1738,6 +1769,12 @@ export default function(Module) {
          *     added to this table. When exceeded, old rows will be overwritten
          *     in the order they were inserted. `limit` cannot be applied at
          *     the same time as `index`.
+         * @param {string} options.expire_column A datetime or integer column by
+         *     which rows expire, compared against the current time in
+         *     milliseconds since the epoch. Must be set with `expire_after`.
+         * @param {integer} options.expire_after Rows whose `expire_column` is
+         *     older than this many milliseconds are removed from the table as
+         *     they age out.
          *
          * @returns {Promise<table>} A Promise that will resolve to a new
          * {@link module:perspective~table} object, or be rejected if an error
@@ -1775,6 +1812,17 @@ export default function(Module) {
                 throw `Cannot specify both index '${options.index}' and limit '${options.limit}'.`;
             }
 
+            const has_expiry = options.expire_column !== undefined || options.expire_after !== undefined;
+            if (has_expiry) {
+                if (options.expire_column === undefined || options.expire_after === undefined) {
+                    throw `'expire_column' and 'expire_after' must be set together.`;
+                }
+
+                if (!Number.isInteger(options.expire_after) || options.expire_after <= 0) {
+                    throw `'expire_after' must be a positive integer, but got '${options.expire_after}'.`;
+                }
+            }
+
             let _Table;
 
             try {
@@ -1786,6 +1834,11 @@ export default function(Module) {
                 // must be created on port 0.
                 _Table = make_table(data_accessor, undefined, options.index, options.limit, op, false, is_arrow, is_csv, 0);
 
+                if (has_expiry) {
+                    __MODULE__.set_table_expiry(_Table, options.expire_column, options.expire_after);
+                    _set_expiry_timer(_Table.get_pool(), _Table.get_id());
+                }
+
                 // Pass through user-provided values or `null` to the
                 // Javascript Table constructor.
                 return new table(_Table, options.index, undefined, options.limit, overridden_types);
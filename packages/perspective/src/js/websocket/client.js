@@ -7,6 +7,7 @@
  *
  */
 import {Client} from "../api/client.js";
+import {FRAME_MESSAGE, FRAME_UPDATE, decode_frame, encode_frame, frame_length, is_frame} from "./protocol.js";
 
 // Initiate a `ping` to the server every 30 seconds
 const PING_TIMEOUT = 30000;
@@ -38,7 +39,9 @@ export class WebSocketClient extends Client {
                 return;
             }
 
-            if (this._pending_binary) {
+            if (this._pending_frame || (!this._pending_binary && is_frame(msg.data))) {
+                this._receive_frame(msg.data);
+            } else if (this._pending_binary) {
                 // Process a binary being sent by the server, which
                 // can decide how many chunks to send and the size of each
                 // chunk.
@@ -117,6 +120,51 @@ export class WebSocketClient extends Client {
         };
     }
 
+    /**
+     * Receive a binary frame, or a chunk of one - frames longer than the
+     * server's chunk size are split across messages, and reassembled using
+     * the lengths in the frame's prefix.
+     */
+    _receive_frame(chunk) {
+        if (!this._pending_frame) {
+            const length = frame_length(chunk);
+            if (chunk.byteLength === length) {
+                this._handle_frame(chunk);
+                return;
+            }
+
+            this._pending_frame = new Uint8Array(length);
+            this._total_chunk_length = 0;
+        }
+
+        this._pending_frame.set(new Uint8Array(chunk), this._total_chunk_length);
+        this._total_chunk_length += chunk.byteLength;
+
+        if (this._total_chunk_length === this._pending_frame.byteLength) {
+            const frame = this._pending_frame.buffer;
+            delete this._pending_frame;
+            this._total_chunk_length = 0;
+            this._handle_frame(frame);
+        }
+    }
+
+    _handle_frame(buffer) {
+        const frame = decode_frame(buffer);
+        if (frame.kind === FRAME_UPDATE) {
+            const data = {port_id: frame.port_id};
+            if (frame.payload) {
+                data.delta = frame.payload;
+            }
+
+            this._handle({data: {id: frame.id, data}});
+        } else if (frame.kind === FRAME_MESSAGE && frame.header) {
+            this._handle({data: frame.header});
+        } else if (frame.kind === FRAME_MESSAGE) {
+            // A binary result, i.e. `to_arrow()`, has no JSON header.
+            this._handle({data: {id: frame.id, data: frame.payload}});
+        }
+    }
+
     /**
      * Send a message to the server, checking whether the arguments contain an
      * ArrayBuffer.
@@ -127,8 +175,26 @@ export class WebSocketClient extends Client {
      * containing the ArrayBuffer. This allows for transport of metadata
      * alongside an ArrayBuffer, and the pattern should be implemented by the
      * receiver.
+     *
+     * If the server supports the `binary_protocol`, messages are instead
+     * sent as binary frames, with an ArrayBuffer argument as the frame's
+     * payload, and the server replies to them with frames as well.
      */
     send(msg) {
+        // `init` and other messages without a response have negative ids,
+        // which a frame cannot carry.
+        if (this._features?.binary_protocol && msg.id >= 0) {
+            let payload;
+            let header = msg;
+            if (msg.args && msg.args.length > 0 && msg.args[0] instanceof ArrayBuffer) {
+                payload = msg.args[0];
+                header = {...msg, args: msg.args.slice(1)};
+            }
+
+            this._ws.send(encode_frame(FRAME_MESSAGE, msg.id, JSON.stringify(header), payload));
+            return;
+        }
+
         if (msg.args && msg.args.length > 0 && msg.args[0] instanceof ArrayBuffer && msg.args[0].byteLength !== undefined) {
             const pre_msg = msg;
             msg.binary_length = msg.args[0].byteLength;
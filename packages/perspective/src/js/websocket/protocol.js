@@ -0,0 +1,129 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2017, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+/**
+ * The binary frames of `perspective-python`'s manager protocol (see
+ * `perspective.manager.protocol`), which carry arrows without a JSON
+ * pre-message, and `on_update` notifications without any JSON at all.
+ */
+
+// Binary frames begin with these magic bytes, which can never begin a JSON
+// message.
+const FRAME_MAGIC = [0x50, 0x53, 0x50, 0x42]; // "PSPB"
+const FRAME_VERSION = 1;
+
+// A method call or its result. The frame's header is the JSON message without
+// its binary argument or result, which is the frame's payload.
+export const FRAME_MESSAGE = 0;
+
+// An `on_update` notification, which carries the `port_id` in the frame and
+// the row delta, if any, as the payload - there is no JSON header.
+export const FRAME_UPDATE = 1;
+
+// magic, version, kind, reserved, id, port_id, header length, payload length,
+// all little-endian.
+export const FRAME_PREFIX_LENGTH = 24;
+
+const encoder = new TextEncoder();
+const decoder = new TextDecoder();
+
+/**
+ * Whether `buffer` (an `ArrayBuffer`) begins a binary frame.
+ */
+export function is_frame(buffer) {
+    if (!(buffer instanceof ArrayBuffer) || buffer.byteLength < FRAME_MAGIC.length) {
+        return false;
+    }
+
+    const bytes = new Uint8Array(buffer, 0, FRAME_MAGIC.length);
+    return FRAME_MAGIC.every((byte, idx) => bytes[idx] === byte);
+}
+
+/**
+ * The total length in bytes of the frame which `buffer` begins, so a frame
+ * chunked across several messages can be reassembled.
+ */
+export function frame_length(buffer) {
+    const view = new DataView(buffer, 0, FRAME_PREFIX_LENGTH);
+    return FRAME_PREFIX_LENGTH + view.getUint32(16, true) + view.getUint32(20, true);
+}
+
+/**
+ * Encode a binary frame.
+ *
+ * @param {number} kind `FRAME_MESSAGE` or `FRAME_UPDATE`.
+ * @param {number} id the id of the message.
+ * @param {string} [header] a JSON-serialized header.
+ * @param {ArrayBuffer} [payload] a binary payload, i.e. an arrow.
+ * @param {number} [port_id] the port of an `on_update` notification.
+ * @returns {ArrayBuffer}
+ */
+export function encode_frame(kind, id, header, payload, port_id = 0) {
+    const header_bytes = header ? encoder.encode(header) : new Uint8Array(0);
+    const payload_bytes = payload ? new Uint8Array(payload) : new Uint8Array(0);
+    const buffer = new ArrayBuffer(FRAME_PREFIX_LENGTH + header_bytes.byteLength + payload_bytes.byteLength);
+    const bytes = new Uint8Array(buffer);
+    const view = new DataView(buffer);
+
+    bytes.set(FRAME_MAGIC, 0);
+    view.setUint8(4, FRAME_VERSION);
+    view.setUint8(5, kind);
+    view.setUint16(6, 0, true);
+    view.setUint32(8, id || 0, true);
+    view.setInt32(12, port_id || 0, true);
+    view.setUint32(16, header_bytes.byteLength, true);
+    view.setUint32(20, payload_bytes.byteLength, true);
+    bytes.set(header_bytes, FRAME_PREFIX_LENGTH);
+    bytes.set(payload_bytes, FRAME_PREFIX_LENGTH + header_bytes.byteLength);
+    return buffer;
+}
+
+/**
+ * Decode a binary frame encoded by `encode_frame` or by `perspective-python`.
+ *
+ * @param {ArrayBuffer} buffer a binary frame.
+ * @returns {{kind: number, id: number, port_id: number, header: Object,
+ * payload: ArrayBuffer}} `header` and `payload` are `undefined` if the frame
+ * has none.
+ */
+export function decode_frame(buffer) {
+    if (buffer.byteLength < FRAME_PREFIX_LENGTH) {
+        throw new Error("Binary frame is truncated.");
+    }
+
+    const view = new DataView(buffer);
+    const version = view.getUint8(4);
+    if (!is_frame(buffer) || version !== FRAME_VERSION) {
+        throw new Error(`Unsupported binary frame version ${version}.`);
+    }
+
+    const expected = frame_length(buffer);
+    if (buffer.byteLength !== expected) {
+        throw new Error(`Binary frame is ${buffer.byteLength} bytes, but expected ${expected}.`);
+    }
+
+    const header_length = view.getUint32(16, true);
+    const payload_length = view.getUint32(20, true);
+    const header_end = FRAME_PREFIX_LENGTH + header_length;
+    const frame = {
+        kind: view.getUint8(5),
+        id: view.getUint32(8, true),
+        port_id: view.getInt32(12, true)
+    };
+
+    if (header_length > 0) {
+        frame.header = JSON.parse(decoder.decode(new Uint8Array(buffer, FRAME_PREFIX_LENGTH, header_length)));
+    }
+
+    if (payload_length > 0) {
+        frame.payload = buffer.slice(header_end, header_end + payload_length);
+    }
+
+    return frame;
+}
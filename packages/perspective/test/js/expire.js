@@ -0,0 +1,66 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2017, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+module.exports = perspective => {
+    describe("Expiry", function() {
+        it("removes rows older than the window on update", async function() {
+            const now = Date.now();
+            const table = await perspective.table(
+                {a: [1, 2], t: [new Date(now - 100000), new Date(now)]},
+                {index: "a", expire_column: "t", expire_after: 60000}
+            );
+            const view = await table.view();
+            table.update({a: [3], t: [new Date(now)]});
+            const json = await view.to_columns();
+            expect(json.a).toEqual([2, 3]);
+            view.delete();
+            table.delete();
+        });
+
+        it("removes rows as they age out, without an update", async function() {
+            const now = Date.now();
+            const table = await perspective.table(
+                {a: [1, 2], t: [new Date(now - 59000), new Date(now)]},
+                {index: "a", expire_column: "t", expire_after: 60000}
+            );
+            const view = await table.view();
+            await new Promise(resolve => view.on_update(resolve));
+            const json = await view.to_columns();
+            expect(json.a).toEqual([2]);
+            view.delete();
+            table.delete();
+        });
+
+        it("max and min follow rows out of the window", async function() {
+            const now = Date.now();
+            const table = await perspective.table(
+                {a: [1, 2, 3], x: [10, 2, 3], t: [new Date(now - 100000), new Date(now), new Date(now)]},
+                {index: "a", expire_column: "t", expire_after: 60000}
+            );
+            const high = await table.view({row_pivots: ["a"], columns: ["x"], aggregates: {x: "max"}});
+            const low = await table.view({row_pivots: ["a"], columns: ["x"], aggregates: {x: "min"}});
+            table.update({a: [4], x: [1], t: [new Date(now)]});
+            expect((await high.to_columns()).x).toEqual([3, 2, 3, 1]);
+            expect((await low.to_columns()).x).toEqual([1, 2, 3, 1]);
+            high.delete();
+            low.delete();
+            table.delete();
+        });
+
+        it("requires both expire_column and expire_after", async function() {
+            expect.assertions(1);
+
+            try {
+                await perspective.table({a: [1]}, {expire_column: "a"});
+            } catch (error) {
+                expect(error).toBeDefined();
+            }
+        });
+    });
+};
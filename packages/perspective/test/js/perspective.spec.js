@@ -27,6 +27,7 @@ const pivot_nulls = require("./pivot_nulls.js");
 const computed_tests = require("./computed.js");
 const delete_tests = require("./delete.js");
 const port_tests = require("./ports.js");
+const expire_tests = require("./expire.js");
 
 describe("perspective.js", function() {
     Object.keys(RUNTIMES).forEach(function(mode) {
@@ -45,6 +46,7 @@ describe("perspective.js", function() {
             computed_tests(RUNTIMES[mode], mode);
             delete_tests(RUNTIMES[mode], mode);
             port_tests(RUNTIMES[mode], mode);
+            expire_tests(RUNTIMES[mode], mode);
         });
     });
 });
@@ -0,0 +1,57 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2017, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+const {FRAME_MESSAGE, FRAME_UPDATE, decode_frame, encode_frame, frame_length, is_frame} = require("../../dist/cjs/websocket/protocol.js");
+
+// `encode_frame(FRAME_UPDATE, 7, header='{"a": 1}', payload=b"abc", port_id=3)`
+// from `perspective.manager.protocol`.
+const PYTHON_FRAME = [80, 83, 80, 66, 1, 1, 0, 0, 7, 0, 0, 0, 3, 0, 0, 0, 8, 0, 0, 0, 3, 0, 0, 0, 123, 34, 97, 34, 58, 32, 49, 125, 97, 98, 99];
+
+describe("Binary protocol", function() {
+    it("round trips a frame", function() {
+        const payload = new Uint8Array([1, 2, 3]).buffer;
+        const frame = encode_frame(FRAME_MESSAGE, 5, JSON.stringify({cmd: "table"}), payload);
+        expect(is_frame(frame)).toEqual(true);
+        expect(frame_length(frame)).toEqual(frame.byteLength);
+
+        const decoded = decode_frame(frame);
+        expect(decoded.kind).toEqual(FRAME_MESSAGE);
+        expect(decoded.id).toEqual(5);
+        expect(decoded.port_id).toEqual(0);
+        expect(decoded.header).toEqual({cmd: "table"});
+        expect(Array.from(new Uint8Array(decoded.payload))).toEqual([1, 2, 3]);
+    });
+
+    it("matches perspective-python's encoding", function() {
+        const payload = new Uint8Array([97, 98, 99]).buffer;
+        const frame = encode_frame(FRAME_UPDATE, 7, '{"a": 1}', payload, 3);
+        expect(Array.from(new Uint8Array(frame))).toEqual(PYTHON_FRAME);
+
+        const decoded = decode_frame(new Uint8Array(PYTHON_FRAME).buffer);
+        expect(decoded.kind).toEqual(FRAME_UPDATE);
+        expect(decoded.port_id).toEqual(3);
+        expect(decoded.header).toEqual({a: 1});
+    });
+
+    it("decodes a frame without a header or payload", function() {
+        const decoded = decode_frame(encode_frame(FRAME_MESSAGE, 1));
+        expect(decoded.header).toBeUndefined();
+        expect(decoded.payload).toBeUndefined();
+    });
+
+    it("is not a frame", function() {
+        expect(is_frame(JSON.stringify({id: 1}))).toEqual(false);
+        expect(is_frame(new Uint8Array([65, 82, 82, 79, 87, 49]).buffer)).toEqual(false);
+    });
+
+    it("rejects a truncated frame", function() {
+        const frame = encode_frame(FRAME_MESSAGE, 1, undefined, new Uint8Array([1, 2, 3]).buffer);
+        expect(() => decode_frame(frame.slice(0, frame.byteLength - 1))).toThrow();
+    });
+});
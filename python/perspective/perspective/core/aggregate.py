@@ -29,8 +29,10 @@ class Aggregate(Enum):
     LAST = "last"
     HIGH = "high"
     LOW = "low"
+    MAX = "max"
     MEAN = "mean"
     MEDIAN = "median"
+    MIN = "min"
     OR = "or"
     PCT_SUM_PARENT = "pct sum parent"
     PCT_SUM_GRAND_TOTAL = "pct sum grand total"
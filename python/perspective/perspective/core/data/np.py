@@ -8,7 +8,6 @@
 
 import six
 import numpy as np
-from datetime import datetime
 
 DATE_DTYPES = [
     np.dtype("datetime64[D]"),
@@ -30,8 +29,6 @@ def make_null_mask(array):
     Args:
         array (:obj:`numpy.array`)
     """
-    mask = []
-
     is_object_or_string_dtype = np.issubdtype(array.dtype, np.str_) or np.issubdtype(
         array.dtype, np.object_
     )
@@ -41,23 +38,17 @@ def make_null_mask(array):
             array.dtype, np.unicode_
         )
 
-    is_datetime_dtype = np.issubdtype(array.dtype, np.datetime64) or np.issubdtype(
+    if is_object_or_string_dtype:
+        return [i for i, item in enumerate(array) if item is None]
+    elif np.issubdtype(array.dtype, np.datetime64) or np.issubdtype(
         array.dtype, np.timedelta64
-    )
-
-    for i, item in enumerate(array):
-        invalid = item is None
-
-        if not is_object_or_string_dtype:
-            if is_datetime_dtype:
-                invalid = invalid or str(item) == "NaT"
-            else:
-                invalid = invalid or np.isnan(item)
-
-        if invalid:
-            mask.append(i)
-
-    return mask
+    ):
+        return np.flatnonzero(np.isnat(array))
+    elif np.issubdtype(array.dtype, np.inexact):
+        return np.flatnonzero(np.isnan(array))
+    else:
+        # integer and boolean arrays cannot contain nulls
+        return []
 
 
 def deconstruct_numpy(array, mask=None):
@@ -81,26 +72,9 @@ def deconstruct_numpy(array, mask=None):
         # bool => byte
         array = array.astype("b", copy=False)
     elif np.issubdtype(array.dtype, np.datetime64):
-        # treat days/weeks/months/years as datetime objects - avoid idiosyncracy
-        # with days of month, etc.
-        if array.dtype in DATE_DTYPES:
-            array = array.astype(datetime)
-
-        # cast datetimes to millisecond timestamps
-        # because datetime64("nat") is a double, cast to float64 here - C++
-        # handles the rest
-        if array.dtype == np.dtype("datetime64[us]"):
-            array = array.astype(np.float64, copy=False) / 1000
-        elif array.dtype == np.dtype("datetime64[ns]"):
-            array = array.astype(np.float64, copy=False) / 1000000
-        elif array.dtype == np.dtype("datetime64[ms]"):
-            array = array.astype(np.float64, copy=False)
-        elif array.dtype == np.dtype("datetime64[s]"):
-            array = array.astype(np.float64, copy=False) * 1000
-        elif array.dtype == np.dtype("datetime64[m]"):
-            array = array.astype(np.float64, copy=False) * 60000
-        elif array.dtype == np.dtype("datetime64[h]"):
-            array = array.astype(np.float64, copy=False) * 3600000
+        # datetime64 arrays of every unit are converted in C++, which needs a
+        # contiguous buffer.
+        array = np.ascontiguousarray(array)
     elif np.issubdtype(array.dtype, np.timedelta64):
         array = array.astype(np.float64, copy=False)
 
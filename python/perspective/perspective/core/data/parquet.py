@@ -0,0 +1,130 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import itertools
+import os
+from ..exception import PerspectiveError
+
+# Parquet files begin and end with these magic bytes.
+PARQUET_MAGIC = b"PAR1"
+
+
+def _import_pyarrow():
+    """Import `pyarrow` and `pyarrow.parquet`, which are only required for
+    reading and writing Parquet."""
+    try:
+        import pyarrow
+        import pyarrow.parquet
+    except ImportError:
+        raise PerspectiveError("Reading and writing Parquet requires `pyarrow`.")
+
+    return pyarrow, pyarrow.parquet
+
+
+def is_parquet(data):
+    """Returns whether `data` is a Parquet binary, or a path-like object
+    pointing to a Parquet file.
+
+    Args:
+        data (:obj:`bytes`/:obj:`bytearray`/:obj:`pathlib.Path`)
+
+    Returns:
+        :obj:`bool`
+    """
+    if isinstance(data, (bytes, bytearray)):
+        return data[:4] == PARQUET_MAGIC
+    elif hasattr(data, "__fspath__"):
+        try:
+            with open(os.fspath(data), "rb") as f:
+                return f.read(4) == PARQUET_MAGIC
+        except (IOError, OSError):
+            return False
+
+    return False
+
+
+def parquet_to_reader(data, columns=None):
+    """Open a Parquet binary or file as a :obj:`pyarrow.RecordBatchReader`,
+    which Perspective imports through the arrow C stream interface and loads
+    one record batch at a time, so the file is never materialized as a single
+    arrow table nor re-serialized to an arrow binary.
+
+    Each row group's columns are decoded in parallel by `pyarrow`. String
+    columns are read as dictionaries straight from the file's dictionary
+    pages, so Perspective interns each distinct value once per batch rather
+    than once per row.
+
+    Args:
+        data (:obj:`bytes`/:obj:`bytearray`/:obj:`pathlib.Path`): a Parquet
+            binary or a path to a Parquet file, which is memory-mapped.
+
+    Keyword Args:
+        columns (:obj:`list`): If set, only these columns are decoded.
+
+    Returns:
+        :obj:`pyarrow.RecordBatchReader`: A file without row groups yields no
+            batches, but still has the file's schema.
+    """
+    pa, pq = _import_pyarrow()
+
+    if isinstance(data, (bytes, bytearray)):
+        source = pa.BufferReader(data)
+    else:
+        source = pa.memory_map(os.fspath(data), "r")
+
+    schema = pq.ParquetFile(source).schema_arrow
+
+    if columns is not None:
+        columns = [name for name in schema.names if name in columns]
+        schema = pa.schema([schema.field(name) for name in columns])
+
+    dictionary_columns = [
+        field.name
+        for field in schema
+        if pa.types.is_string(field.type) or pa.types.is_large_string(field.type)
+    ]
+
+    parquet_file = pq.ParquetFile(source, read_dictionary=dictionary_columns)
+    batches = parquet_file.iter_batches(columns=columns, use_threads=True)
+
+    # The dictionary-encoded schema is only known once a batch is decoded.
+    first = next(batches, None)
+    if first is None:
+        return pa.RecordBatchReader.from_batches(schema, [])
+
+    return pa.RecordBatchReader.from_batches(
+        first.schema, itertools.chain([first], batches)
+    )
+
+
+def arrow_to_parquet(arrow, path=None, compression="snappy"):
+    """Write an arrow stream, i.e. from :func:`perspective.View.to_arrow`, as
+    Parquet.
+
+    Args:
+        arrow (:obj:`bytes`): an arrow stream.
+
+    Keyword Args:
+        path (:obj:`str`/:obj:`pathlib.Path`): If set, the Parquet is written
+            to this path.
+        compression (:obj:`str`): The Parquet compression codec.
+
+    Returns:
+        :obj:`bytes`: the Parquet binary, or `None` if written to `path`.
+    """
+    pa, pq = _import_pyarrow()
+    table = pa.ipc.open_stream(pa.py_buffer(arrow)).read_all()
+
+    if path is not None:
+        pq.write_table(table, os.fspath(path), compression=compression)
+        return None
+
+    sink = pa.BufferOutputStream()
+    pq.write_table(table, sink, compression=compression)
+    return sink.getvalue().to_pybytes()
+
@@ -72,12 +72,17 @@ PYBIND11_MODULE(libbinding, m)
     py::class_<Table, std::shared_ptr<Table>>(m, "Table")
         .def(py::init<std::shared_ptr<t_pool>, std::vector<std::string>, std::vector<t_dtype>,
         std::uint32_t, std::string>())
-        .def("size", &Table::size)
-        .def("get_schema", &Table::get_schema)
-        .def("unregister_gnode", &Table::unregister_gnode)
-        .def("reset_gnode", &Table::reset_gnode)
-        .def("make_port", &Table::make_port)
-        .def("remove_port", &Table::remove_port)
+        .def("size", with_engine_lock(&Table::size))
+        .def("get_schema", with_engine_lock(&Table::get_schema))
+        .def("unregister_gnode", with_engine_lock(&Table::unregister_gnode))
+        .def("reset_gnode", with_engine_lock(&Table::reset_gnode))
+        .def("make_port", with_engine_lock(&Table::make_port))
+        .def("remove_port", with_engine_lock(&Table::remove_port))
+        .def("set_expiry", with_engine_lock(&Table::set_expiry))
+        .def("compact_vocabularies", with_engine_lock(&Table::compact_vocabularies))
+        .def("get_vocab_size", with_engine_lock(&Table::get_vocab_size))
+        .def("get_offset", with_engine_lock(&Table::get_offset))
+        .def("set_offset", with_engine_lock(&Table::set_offset))
         .def("get_id", &Table::get_id)
         .def("get_pool", &Table::get_pool)
         .def("get_gnode", &Table::get_gnode);
@@ -91,103 +96,103 @@ PYBIND11_MODULE(libbinding, m)
         .def(py::init<std::shared_ptr<Table>, std::shared_ptr<t_ctxunit>, std::string, std::string,
             std::shared_ptr<t_view_config>>())
         .def("sides", &View<t_ctxunit>::sides)
-        .def("num_rows", &View<t_ctxunit>::num_rows)
-        .def("num_columns", &View<t_ctxunit>::num_columns)
-        .def("get_row_expanded", &View<t_ctxunit>::get_row_expanded)
-        .def("schema", &View<t_ctxunit>::schema)
-        .def("computed_schema", &View<t_ctxunit>::computed_schema)
-        .def("column_names", &View<t_ctxunit>::column_names)
-        .def("column_paths", &View<t_ctxunit>::column_paths)
-        .def("_get_deltas_enabled", &View<t_ctxunit>::_get_deltas_enabled)
-        .def("_set_deltas_enabled", &View<t_ctxunit>::_set_deltas_enabled)
+        .def("num_rows", with_engine_lock(&View<t_ctxunit>::num_rows))
+        .def("num_columns", with_engine_lock(&View<t_ctxunit>::num_columns))
+        .def("get_row_expanded", with_engine_lock(&View<t_ctxunit>::get_row_expanded))
+        .def("schema", with_engine_lock(&View<t_ctxunit>::schema))
+        .def("computed_schema", with_engine_lock(&View<t_ctxunit>::computed_schema))
+        .def("column_names", with_engine_lock(&View<t_ctxunit>::column_names))
+        .def("column_paths", with_engine_lock(&View<t_ctxunit>::column_paths))
+        .def("_get_deltas_enabled", with_engine_lock(&View<t_ctxunit>::_get_deltas_enabled))
+        .def("_set_deltas_enabled", with_engine_lock(&View<t_ctxunit>::_set_deltas_enabled))
         .def("get_context", &View<t_ctxunit>::get_context)
         .def("get_row_pivots", &View<t_ctxunit>::get_row_pivots)
         .def("get_column_pivots", &View<t_ctxunit>::get_column_pivots)
         .def("get_aggregates", &View<t_ctxunit>::get_aggregates)
         .def("get_filter", &View<t_ctxunit>::get_filter)
         .def("get_sort", &View<t_ctxunit>::get_sort)
-        .def("get_min_max", &View<t_ctxunit>::get_min_max)
-        .def("get_step_delta", &View<t_ctxunit>::get_step_delta)
-        .def("get_column_dtype", &View<t_ctxunit>::get_column_dtype)
+        .def("get_min_max", with_engine_lock(&View<t_ctxunit>::get_min_max))
+        .def("get_step_delta", with_engine_lock(&View<t_ctxunit>::get_step_delta))
+        .def("get_column_dtype", with_engine_lock(&View<t_ctxunit>::get_column_dtype))
         .def("is_column_only", &View<t_ctxunit>::is_column_only);
 
     py::class_<View<t_ctx0>, std::shared_ptr<View<t_ctx0>>>(m, "View_ctx0")
         .def(py::init<std::shared_ptr<Table>, std::shared_ptr<t_ctx0>, std::string, std::string,
             std::shared_ptr<t_view_config>>())
         .def("sides", &View<t_ctx0>::sides)
-        .def("num_rows", &View<t_ctx0>::num_rows)
-        .def("num_columns", &View<t_ctx0>::num_columns)
-        .def("get_row_expanded", &View<t_ctx0>::get_row_expanded)
-        .def("schema", &View<t_ctx0>::schema)
-        .def("computed_schema", &View<t_ctx0>::computed_schema)
-        .def("column_names", &View<t_ctx0>::column_names)
-        .def("column_paths", &View<t_ctx0>::column_paths)
-        .def("_get_deltas_enabled", &View<t_ctx0>::_get_deltas_enabled)
-        .def("_set_deltas_enabled", &View<t_ctx0>::_set_deltas_enabled)
+        .def("num_rows", with_engine_lock(&View<t_ctx0>::num_rows))
+        .def("num_columns", with_engine_lock(&View<t_ctx0>::num_columns))
+        .def("get_row_expanded", with_engine_lock(&View<t_ctx0>::get_row_expanded))
+        .def("schema", with_engine_lock(&View<t_ctx0>::schema))
+        .def("computed_schema", with_engine_lock(&View<t_ctx0>::computed_schema))
+        .def("column_names", with_engine_lock(&View<t_ctx0>::column_names))
+        .def("column_paths", with_engine_lock(&View<t_ctx0>::column_paths))
+        .def("_get_deltas_enabled", with_engine_lock(&View<t_ctx0>::_get_deltas_enabled))
+        .def("_set_deltas_enabled", with_engine_lock(&View<t_ctx0>::_set_deltas_enabled))
         .def("get_context", &View<t_ctx0>::get_context)
         .def("get_row_pivots", &View<t_ctx0>::get_row_pivots)
         .def("get_column_pivots", &View<t_ctx0>::get_column_pivots)
         .def("get_aggregates", &View<t_ctx0>::get_aggregates)
         .def("get_filter", &View<t_ctx0>::get_filter)
         .def("get_sort", &View<t_ctx0>::get_sort)
-        .def("get_min_max", &View<t_ctx0>::get_min_max)
-        .def("get_step_delta", &View<t_ctx0>::get_step_delta)
-        .def("get_column_dtype", &View<t_ctx0>::get_column_dtype)
+        .def("get_min_max", with_engine_lock(&View<t_ctx0>::get_min_max))
+        .def("get_step_delta", with_engine_lock(&View<t_ctx0>::get_step_delta))
+        .def("get_column_dtype", with_engine_lock(&View<t_ctx0>::get_column_dtype))
         .def("is_column_only", &View<t_ctx0>::is_column_only);
 
     py::class_<View<t_ctx1>, std::shared_ptr<View<t_ctx1>>>(m, "View_ctx1")
         .def(py::init<std::shared_ptr<Table>, std::shared_ptr<t_ctx1>, std::string, std::string,
             std::shared_ptr<t_view_config>>())
         .def("sides", &View<t_ctx1>::sides)
-        .def("num_rows", &View<t_ctx1>::num_rows)
-        .def("num_columns", &View<t_ctx1>::num_columns)
-        .def("get_row_expanded", &View<t_ctx1>::get_row_expanded)
-        .def("expand", &View<t_ctx1>::expand)
-        .def("collapse", &View<t_ctx1>::collapse)
-        .def("set_depth", &View<t_ctx1>::set_depth)
-        .def("schema", &View<t_ctx1>::schema)
-        .def("computed_schema", &View<t_ctx1>::computed_schema)
-        .def("column_names", &View<t_ctx1>::column_names)
-        .def("column_paths", &View<t_ctx1>::column_paths)
-        .def("_get_deltas_enabled", &View<t_ctx1>::_get_deltas_enabled)
-        .def("_set_deltas_enabled", &View<t_ctx1>::_set_deltas_enabled)
+        .def("num_rows", with_engine_lock(&View<t_ctx1>::num_rows))
+        .def("num_columns", with_engine_lock(&View<t_ctx1>::num_columns))
+        .def("get_row_expanded", with_engine_lock(&View<t_ctx1>::get_row_expanded))
+        .def("expand", &expand_one)
+        .def("collapse", &collapse_one)
+        .def("set_depth", &set_depth_one)
+        .def("schema", with_engine_lock(&View<t_ctx1>::schema))
+        .def("computed_schema", with_engine_lock(&View<t_ctx1>::computed_schema))
+        .def("column_names", with_engine_lock(&View<t_ctx1>::column_names))
+        .def("column_paths", with_engine_lock(&View<t_ctx1>::column_paths))
+        .def("_get_deltas_enabled", with_engine_lock(&View<t_ctx1>::_get_deltas_enabled))
+        .def("_set_deltas_enabled", with_engine_lock(&View<t_ctx1>::_set_deltas_enabled))
         .def("get_context", &View<t_ctx1>::get_context)
         .def("get_row_pivots", &View<t_ctx1>::get_row_pivots)
         .def("get_column_pivots", &View<t_ctx1>::get_column_pivots)
         .def("get_aggregates", &View<t_ctx1>::get_aggregates)
         .def("get_filter", &View<t_ctx1>::get_filter)
         .def("get_sort", &View<t_ctx1>::get_sort)
-        .def("get_min_max", &View<t_ctx1>::get_min_max)
-        .def("get_step_delta", &View<t_ctx1>::get_step_delta)
-        .def("get_column_dtype", &View<t_ctx1>::get_column_dtype)
+        .def("get_min_max", with_engine_lock(&View<t_ctx1>::get_min_max))
+        .def("get_step_delta", with_engine_lock(&View<t_ctx1>::get_step_delta))
+        .def("get_column_dtype", with_engine_lock(&View<t_ctx1>::get_column_dtype))
         .def("is_column_only", &View<t_ctx1>::is_column_only);
 
     py::class_<View<t_ctx2>, std::shared_ptr<View<t_ctx2>>>(m, "View_ctx2")
         .def(py::init<std::shared_ptr<Table>, std::shared_ptr<t_ctx2>, std::string, std::string,
             std::shared_ptr<t_view_config>>())
         .def("sides", &View<t_ctx2>::sides)
-        .def("num_rows", &View<t_ctx2>::num_rows)
-        .def("num_columns", &View<t_ctx2>::num_columns)
-        .def("get_row_expanded", &View<t_ctx2>::get_row_expanded)
-        .def("expand", &View<t_ctx2>::expand)
-        .def("collapse", &View<t_ctx2>::collapse)
-        .def("set_depth", &View<t_ctx2>::set_depth)
-        .def("schema", &View<t_ctx2>::schema)
-        .def("computed_schema", &View<t_ctx2>::computed_schema)
-        .def("column_names", &View<t_ctx2>::column_names)
-        .def("column_paths", &View<t_ctx2>::column_paths)
-        .def("_get_deltas_enabled", &View<t_ctx2>::_get_deltas_enabled)
-        .def("_set_deltas_enabled", &View<t_ctx2>::_set_deltas_enabled)
+        .def("num_rows", with_engine_lock(&View<t_ctx2>::num_rows))
+        .def("num_columns", with_engine_lock(&View<t_ctx2>::num_columns))
+        .def("get_row_expanded", with_engine_lock(&View<t_ctx2>::get_row_expanded))
+        .def("expand", &expand_two)
+        .def("collapse", &collapse_two)
+        .def("set_depth", &set_depth_two)
+        .def("schema", with_engine_lock(&View<t_ctx2>::schema))
+        .def("computed_schema", with_engine_lock(&View<t_ctx2>::computed_schema))
+        .def("column_names", with_engine_lock(&View<t_ctx2>::column_names))
+        .def("column_paths", with_engine_lock(&View<t_ctx2>::column_paths))
+        .def("_get_deltas_enabled", with_engine_lock(&View<t_ctx2>::_get_deltas_enabled))
+        .def("_set_deltas_enabled", with_engine_lock(&View<t_ctx2>::_set_deltas_enabled))
         .def("get_context", &View<t_ctx2>::get_context)
         .def("get_row_pivots", &View<t_ctx2>::get_row_pivots)
         .def("get_column_pivots", &View<t_ctx2>::get_column_pivots)
         .def("get_aggregates", &View<t_ctx2>::get_aggregates)
         .def("get_filter", &View<t_ctx2>::get_filter)
         .def("get_sort", &View<t_ctx2>::get_sort)
-        .def("get_min_max", &View<t_ctx2>::get_min_max)
-        .def("get_row_path", &View<t_ctx2>::get_row_path)
-        .def("get_step_delta", &View<t_ctx2>::get_step_delta)
-        .def("get_column_dtype", &View<t_ctx2>::get_column_dtype)
+        .def("get_min_max", with_engine_lock(&View<t_ctx2>::get_min_max))
+        .def("get_row_path", with_engine_lock(&View<t_ctx2>::get_row_path))
+        .def("get_step_delta", with_engine_lock(&View<t_ctx2>::get_step_delta))
+        .def("get_column_dtype", with_engine_lock(&View<t_ctx2>::get_column_dtype))
         .def("is_column_only", &View<t_ctx2>::is_column_only);
 
     /******************************************************************************
@@ -295,7 +300,25 @@ PYBIND11_MODULE(libbinding, m)
         .def("set_update_delegate", &t_pool::set_update_delegate)
         .def("unregister_gnode", &t_pool::unregister_gnode)
         .def("set_event_loop", &t_pool::set_event_loop)
-        .def("_process", &t_pool::_process);
+        .def("_process", &process_py)
+        .def("start_processing_thread", &t_pool::start_processing_thread)
+        .def("stop_processing_thread", &stop_processing_thread_py)
+        .def("has_processing_thread", &t_pool::has_processing_thread)
+        .def("get_expiry_deadline", &t_pool::get_expiry_deadline)
+        .def("get_metrics", &t_pool::get_metrics);
+
+    /******************************************************************************
+     *
+     * t_pool_metrics
+     */
+    py::class_<t_pool_metrics>(m, "t_pool_metrics")
+        .def(py::init<>())
+        .def_readonly("queued_batches", &t_pool_metrics::m_queued_batches)
+        .def_readonly("queued_rows", &t_pool_metrics::m_queued_rows)
+        .def_readonly("num_processed", &t_pool_metrics::m_num_processed)
+        .def_readonly("batches_processed", &t_pool_metrics::m_batches_processed)
+        .def_readonly("rows_processed", &t_pool_metrics::m_rows_processed)
+        .def_readonly("max_batch_rows", &t_pool_metrics::m_max_batch_rows);
 
     /******************************************************************************
      *
@@ -407,20 +430,25 @@ PYBIND11_MODULE(libbinding, m)
     m.def("get_data_slice_unit", &get_data_slice_unit);
     m.def("get_from_data_slice_unit", &get_from_data_slice_unit);
     m.def("get_pkeys_from_data_slice_unit", &get_pkeys_from_data_slice_unit);
+    m.def("get_numpy_from_data_slice_unit", &get_numpy_from_data_slice_unit);
     m.def("get_data_slice_zero", &get_data_slice_ctx0);
     m.def("get_from_data_slice_zero", &get_from_data_slice_ctx0);
     m.def("get_pkeys_from_data_slice_zero", &get_pkeys_from_data_slice_ctx0);
+    m.def("get_numpy_from_data_slice_zero", &get_numpy_from_data_slice_ctx0);
     m.def("get_data_slice_one", &get_data_slice_ctx1);
     m.def("get_from_data_slice_one", &get_from_data_slice_ctx1);
     m.def("get_pkeys_from_data_slice_one", &get_pkeys_from_data_slice_ctx1);
+    m.def("get_numpy_from_data_slice_one", &get_numpy_from_data_slice_ctx1);
     m.def("get_data_slice_two", &get_data_slice_ctx2);
     m.def("get_from_data_slice_two", &get_from_data_slice_ctx2);
     m.def("get_pkeys_from_data_slice_two", &get_pkeys_from_data_slice_ctx2);
+    m.def("get_numpy_from_data_slice_two", &get_numpy_from_data_slice_ctx2);
     m.def("to_arrow_unit", &to_arrow_unit);
     m.def("to_arrow_zero", &to_arrow_zero);
     m.def("to_arrow_one", &to_arrow_one);
     m.def("to_arrow_two", &to_arrow_two);
     m.def("get_row_delta_unit", &get_row_delta_unit);
+    m.def("get_row_delta_pkeys_unit", &get_row_delta_pkeys_unit);
     m.def("get_row_delta_zero", &get_row_delta_zero);
     m.def("get_row_delta_one", &get_row_delta_one);
     m.def("get_row_delta_two", &get_row_delta_two);
@@ -15,6 +15,7 @@
 #include <perspective/exception.h>
 #include <perspective/column.h>
 #include <perspective/data_table.h>
+#include <perspective/data_loader.h>
 #include <perspective/python/utils.h>
 
 #ifdef WIN32
@@ -38,7 +39,7 @@ namespace numpy {
     /**
      * NumpyLoader fast-tracks the loading of Numpy arrays into Perspective, utilizing memcpy whenever possible.
      */
-    class PERSPECTIVE_BINDING_EXPORT NumpyLoader {
+    class PERSPECTIVE_BINDING_EXPORT NumpyLoader : public t_data_loader {
         public:
             NumpyLoader(t_val accessor);
             ~NumpyLoader();
@@ -60,12 +61,6 @@ namespace numpy {
              */
             std::vector<t_dtype> reconcile_dtypes(const std::vector<t_dtype>& inferred_types) const;
 
-            /**
-             * Fill a `t_data_table` with numpy array-backed data.
-             */
-            void fill_table(t_data_table& tbl, const t_schema& input_schema, const std::string& index, 
-                std::uint32_t offset, std::uint32_t limit, bool is_update);
-
             /**
              * Fill a column with a Numpy array by copying it wholesale into the column without iteration.
              * 
@@ -87,6 +82,15 @@ namespace numpy {
              * Keep a list of numpy datetime64 units that we should treat as dates and not datetimes.
              */
             static const std::vector<std::string> DATE_UNITS;
+
+        protected:
+            /**
+             * Fill a column of a `t_data_table` from `t_data_loader::fill_table`. Arrays are looked up by
+             * their name in the accessor, so the explicit index is filled from `__INDEX__`.
+             */
+            void fill_column(t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name,
+                const t_loader_column& source, bool is_update) override;
+
         private:
             /**
              * When memory cannot be copied for dtype=object arrays, for example), fill the column through iteration.
@@ -117,9 +121,24 @@ namespace numpy {
              */
             void fill_numeric_iter(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update);
 
-            void fill_datetime_iter(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, 
-                t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update);
-            
+            /**
+             * Fill a `DTYPE_TIME` or `DTYPE_DATE` column from a `datetime64` array of any unit over the whole buffer, with the GIL
+             * released, reading `NaT` as null.
+             * 
+             * Returns `FILL_FAIL` for units that are not converted here: units finer than nanoseconds, and units of a day or coarser
+             * into a `DTYPE_TIME` column, which `marshal` reads in local time.
+             */
+            t_fill_status fill_datetime64(const py::array& array, std::shared_ptr<t_column> col, t_dtype type, bool is_update);
+
+            /**
+             * Convert a numeric array whose dtype does not match the column's `t_dtype` (see `fill_column`) over the whole buffer, with
+             * the GIL released.
+             * 
+             * When filling `DTYPE_INT32` for the first time, values out of its range promote the column to `DTYPE_FLOAT64`, which
+             * replaces `col`. Null values are left to the validity mask.
+             */
+            void fill_numeric_convert(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column>& col, const std::string& name, t_dtype np_dtype, t_dtype type, bool is_update);
+
             void fill_bool_iter(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update);
 
             /**
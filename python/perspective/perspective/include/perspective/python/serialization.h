@@ -55,6 +55,28 @@ std::vector<t_val> get_pkeys_from_data_slice_ctx0(std::shared_ptr<t_data_slice<t
 std::vector<t_val> get_pkeys_from_data_slice_ctx1(std::shared_ptr<t_data_slice<t_ctx1>> data_slice, t_uindex ridx, t_uindex cidx);
 std::vector<t_val> get_pkeys_from_data_slice_ctx2(std::shared_ptr<t_data_slice<t_ctx2>> data_slice, t_uindex ridx, t_uindex cidx);
 
+/**
+ * @brief Read one column of a data slice into a typed numpy array, without
+ * creating a Python object per cell.
+ *
+ * Integer and boolean columns return their nulls as a boolean mask, float
+ * and datetime columns use `NaN` and `NaT`, and string columns are `object`
+ * arrays with `None` for null. Datetimes are returned in local time, as
+ * `scalar_to_py` does. Columns which cannot be typed are `object` arrays of
+ * the same values `get_from_data_slice` returns.
+ *
+ * @param leaf_depth if non-zero, rows whose row path is shorter than
+ * `leaf_depth` are skipped, as `leaves_only` does.
+ * @return py::tuple `(values, mask)`, where `mask` is `None` unless the
+ * column has nulls which `values` cannot represent.
+ */
+template <typename CTX_T>
+py::tuple get_numpy_from_data_slice(std::shared_ptr<t_data_slice<CTX_T>> data_slice, t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth);
+py::tuple get_numpy_from_data_slice_unit(std::shared_ptr<t_data_slice<t_ctxunit>> data_slice, t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth);
+py::tuple get_numpy_from_data_slice_ctx0(std::shared_ptr<t_data_slice<t_ctx0>> data_slice, t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth);
+py::tuple get_numpy_from_data_slice_ctx1(std::shared_ptr<t_data_slice<t_ctx1>> data_slice, t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth);
+py::tuple get_numpy_from_data_slice_ctx2(std::shared_ptr<t_data_slice<t_ctx2>> data_slice, t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth);
+
 } // end namespace binding
 } // end namespace perspective
 
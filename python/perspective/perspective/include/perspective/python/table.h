@@ -23,6 +23,41 @@ namespace binding {
  */
 std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor, std::uint32_t limit, py::str index, t_op op, bool is_update, bool is_arrow, t_uindex port_id);
 
+/**
+ * @brief Process the pool's pending updates with the GIL released, taking it
+ * back only to notify update callbacks.
+ */
+void process_py(t_pool& pool);
+
+/**
+ * @brief Stop the pool's processing thread, releasing the GIL while it
+ * finishes its current update.
+ */
+void stop_processing_thread_py(t_pool& pool);
+
+/**
+ * @brief Bind a method of a `Table` or `View` so that it runs with the GIL
+ * released and its pool's engine lock held, as `_process` may be running on
+ * another thread.
+ */
+template <typename T, typename R, typename... Args>
+auto
+with_engine_lock(R (T::*method)(Args...)) {
+    return [method](T& obj, Args... args) -> R {
+        PerspectiveScopedGILRelease acquire(*obj.get_pool());
+        return (obj.*method)(args...);
+    };
+}
+
+template <typename T, typename R, typename... Args>
+auto
+with_engine_lock(R (T::*method)(Args...) const) {
+    return [method](const T& obj, Args... args) -> R {
+        PerspectiveScopedGILRelease acquire(*obj.get_pool());
+        return (obj.*method)(args...);
+    };
+}
+
 } //namespace binding
 } //namespace perspective
 
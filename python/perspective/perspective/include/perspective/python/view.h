@@ -86,10 +86,18 @@ py::bytes to_arrow_two(
     std::int32_t end_col);
 
 py::bytes get_row_delta_unit(std::shared_ptr<View<t_ctxunit>> view);
+std::vector<t_val> get_row_delta_pkeys_unit(std::shared_ptr<View<t_ctxunit>> view);
 py::bytes get_row_delta_zero(std::shared_ptr<View<t_ctx0>> view);
 py::bytes get_row_delta_one(std::shared_ptr<View<t_ctx1>> view);
 py::bytes get_row_delta_two(std::shared_ptr<View<t_ctx2>> view);
 
+t_index expand_one(std::shared_ptr<View<t_ctx1>> view, std::int32_t ridx, std::int32_t row_pivot_length);
+t_index expand_two(std::shared_ptr<View<t_ctx2>> view, std::int32_t ridx, std::int32_t row_pivot_length);
+t_index collapse_one(std::shared_ptr<View<t_ctx1>> view, std::int32_t ridx);
+t_index collapse_two(std::shared_ptr<View<t_ctx2>> view, std::int32_t ridx);
+void set_depth_one(std::shared_ptr<View<t_ctx1>> view, std::int32_t depth, std::int32_t row_pivot_length);
+void set_depth_two(std::shared_ptr<View<t_ctx2>> view, std::int32_t depth, std::int32_t row_pivot_length);
+
 
 } //namespace binding
 } //namespace perspective
@@ -40,6 +40,12 @@ class PerspectiveManager(_PerspectiveManagerInternal):
         should be spawned using `new_session()`.
     - When the websocket closes, call `close()` on the session instance to
         clean up associated resources.
+
+    Messages may also be binary frames (see `perspective.manager.protocol`),
+    which carry arrows for `table` and `update` as their payload. Results
+    of a binary frame are returned as binary frames, and `on_update`
+    subscriptions made through a binary frame are notified with the port id
+    and row delta as a frame, without encoding any JSON.
     """
 
     def __init__(self, lock=False):
@@ -94,8 +100,8 @@ class PerspectiveManager(_PerspectiveManagerInternal):
         if self._loop_callback is not None:
             # always bind the callback to the table's state manager
             self._loop_callback(lambda: table._table.get_pool().set_event_loop())
-            table._state_manager.queue_process = partial(
-                self._loop_callback, table._state_manager.call_process
+            table._set_queue_process(
+                partial(self._loop_callback, table._state_manager.call_process)
             )
         self._tables[name] = table
         return name
@@ -141,6 +147,6 @@ class PerspectiveManager(_PerspectiveManagerInternal):
         self._loop_callback = loop_callback
         for table in self._tables.values():
             loop_callback(lambda: table._table.get_pool().set_event_loop())
-            table._state_manager.queue_process = partial(
-                loop_callback, table._state_manager.call_process
+            table._set_queue_process(
+                partial(loop_callback, table._state_manager.call_process)
             )
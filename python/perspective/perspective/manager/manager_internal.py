@@ -15,6 +15,14 @@ from ..core.exception import PerspectiveError
 from ..table import Table, PerspectiveCppError
 from ..table._callback_cache import _PerspectiveCallBackCache
 from ..table._date_validator import _PerspectiveDateValidator
+from .protocol import (
+    FRAME_MESSAGE,
+    FRAME_UPDATE,
+    decode_frame,
+    encode_frame,
+    is_frame,
+)
+from .throttle import _PerspectiveUpdateCoalescer, _PerspectiveUpdateThrottle
 
 _date_validator = _PerspectiveDateValidator()
 
@@ -45,6 +53,10 @@ class _PerspectiveManagerInternal(object):
         self._queue_process_callback = None
         self._lock = lock
 
+        # The `on_update` backpressure state of each client that has
+        # enabled it, by `client_id`.
+        self._update_throttles = {}
+
         # Perspective sends binary messages in two messages - a JSON
         # pre-message and the binary itself. Set up flags to handle that
         # special message flow.
@@ -94,7 +106,9 @@ class _PerspectiveManagerInternal(object):
 
             self._pending_binary = None
 
-        if isinstance(msg, string_types):
+        if is_frame(msg):
+            msg = self._frame_to_message(msg)
+        elif isinstance(msg, string_types):
             msg = json.loads(msg)
 
         if not isinstance(msg, dict):
@@ -117,20 +131,20 @@ class _PerspectiveManagerInternal(object):
                 + (("." + msg["method"]) if msg.get("method", None) is not None else "")
             )
             error_message = self._make_error_message(msg["id"], error_string)
-            post_callback(self._message_to_json(msg["id"], error_message))
+            self._post_message(msg, error_message, post_callback)
             return
 
         try:
             if cmd == "init":
                 # The client should wait for the return message on table()
                 # and view() to confirm successful creation.
-                flags = ["wait_for_response"]
+                flags = ["wait_for_response", "binary_protocol"]
 
                 # Return a message to the client to confirm initialization with
                 # a list of feature flags that the client will use to enable
                 # or disable behavior depending on its version.
                 message = self._make_message(msg["id"], flags)
-                post_callback(self._message_to_json(msg["id"], message))
+                self._post_message(msg, message, post_callback)
             elif cmd == "table":
                 try:
                     # create a new Table and track it
@@ -142,7 +156,7 @@ class _PerspectiveManagerInternal(object):
                     # Return the Table's name to the front end so it can be
                     # resolved.
                     message = self._make_message(msg["id"], msg["name"])
-                    post_callback(self._message_to_json(msg["id"], message))
+                    self._post_message(msg, message, post_callback)
                 except IndexError:
                     self._tables[msg["name"]] = []
             elif cmd == "view":
@@ -155,7 +169,7 @@ class _PerspectiveManagerInternal(object):
                 # Return the View's name to the front end so it can be
                 # resolved.
                 message = self._make_message(msg["id"], msg["view_name"])
-                post_callback(self._message_to_json(msg["id"], message))
+                self._post_message(msg, message, post_callback)
             elif cmd == "table_method" or cmd == "view_method":
                 # Call the method on the table/view instance
                 self._process_method_call(msg, post_callback, client_id)
@@ -164,7 +178,7 @@ class _PerspectiveManagerInternal(object):
             error_string = str(error)
             error_message = self._make_error_message(msg["id"], error_string)
             logging.error("[PerspectiveManager._process] %s", error_string)
-            post_callback(self._message_to_json(msg["id"], error_message))
+            self._post_message(msg, error_message, post_callback)
 
     def _process_method_call(self, msg, post_callback, client_id):
         """When the client calls a method, validate the instance it calls on
@@ -178,7 +192,7 @@ class _PerspectiveManagerInternal(object):
                 error_message = self._make_error_message(
                     msg["id"], "View is not initialized"
                 )
-                post_callback(self._message_to_json(msg["id"], error_message))
+                self._post_message(msg, error_message, post_callback)
         try:
             if msg.get("subscribe", False) is True:
                 self._process_subscribe(msg, table_or_view, post_callback, client_id)
@@ -253,12 +267,12 @@ class _PerspectiveManagerInternal(object):
                 else:
                     # return the result to the client
                     message = self._make_message(msg["id"], result)
-                    post_callback(self._message_to_json(msg["id"], message))
+                    self._post_message(msg, message, post_callback)
         except Exception as error:
             error_string = str(error)
             message = self._make_error_message(msg["id"], error_string)
             logging.error("[PerspectiveManager._process_method_call] %s", error_string)
-            post_callback(self._message_to_json(msg["id"], message))
+            self._post_message(msg, message, post_callback)
 
     def _process_subscribe(self, msg, table_or_view, post_callback, client_id):
         """When the client attempts to add or remove a subscription callback,
@@ -281,6 +295,11 @@ class _PerspectiveManagerInternal(object):
             if method and method[:2] == "on":
                 # wrap the callback
                 callback = partial(self.callback, msg=msg, post_callback=post_callback)
+                throttle = self._update_throttles.get(client_id, None)
+                if method == "on_update" and throttle is not None:
+                    callback = self._make_update_coalescer(
+                        throttle, callback, table_or_view, args
+                    )
                 if callback_id:
                     self._callback_cache.add_callback(
                         {
@@ -297,6 +316,7 @@ class _PerspectiveManagerInternal(object):
 
                 for callback in popped_callbacks:
                     getattr(table_or_view, method)(callback["callback"])
+                    self._remove_update_coalescer(client_id, callback["callback"])
             if callback is not None:
                 # call the underlying method on the Table or View, and apply
                 # the dictionary of kwargs that is passed through.
@@ -315,7 +335,7 @@ class _PerspectiveManagerInternal(object):
             error_string = str(error)
             message = self._make_error_message(msg["id"], error_string)
             logging.error("[PerspectiveManager._process_subscribe] %s", error_string)
-            post_callback(self._message_to_json(msg["id"], message))
+            self._post_message(msg, message, post_callback)
 
     def _process_bytes(self, binary, msg, post_callback):
         """Send a bytestring message to the client without attempting to
@@ -336,6 +356,13 @@ class _PerspectiveManagerInternal(object):
                 client, with a `binary` (bool) kwarg that allows it to pass
                 byte messages without serializing to JSON.
         """
+        if msg.get("binary_protocol"):
+            # The binary is the frame's payload, without a JSON header.
+            post_callback(
+                encode_frame(FRAME_MESSAGE, msg["id"], payload=binary), binary=True
+            )
+            return
+
         # Pass the total length of the binary to the client, so it knows to
         # wait until the arrow has been received in whole.
         msg["binary_length"] = len(binary)
@@ -350,6 +377,17 @@ class _PerspectiveManagerInternal(object):
         method = orig_msg["method"]
         post_callback = kwargs.get("post_callback")
 
+        if method == "on_update" and orig_msg.get("binary_protocol"):
+            # Notify the client without serializing anything to JSON - the
+            # `port_id` is part of the frame, and the row delta is its
+            # payload.
+            delta = args[1] if len(args) > 1 and type(args[1]) == bytes else None
+            post_callback(
+                encode_frame(FRAME_UPDATE, id, payload=delta, port_id=args[0]),
+                binary=True,
+            )
+            return
+
         if method == "on_update":
             # Coerce the message to be an object so it can be handled in
             # Javascript, where promises cannot be resolved with multiple args.
@@ -363,7 +401,7 @@ class _PerspectiveManagerInternal(object):
         if len(args) > 1 and type(args[1]) == bytes:
             self._process_bytes(args[1], msg, post_callback)
         else:
-            post_callback(self._message_to_json(msg["id"], msg))
+            self._post_message(orig_msg, msg, post_callback)
 
     def clear_views(self, client_id):
         """Garbage collect views that belong to closed connections."""
@@ -394,6 +432,98 @@ class _PerspectiveManagerInternal(object):
                 )
             )
 
+    def _set_update_throttle(
+        self, client_id, max_update_rate=None, call_later=None, max_merged_rows=100000
+    ):
+        """Coalesce the `on_update` notifications of `client_id` while it is
+        paused or above `max_update_rate`. Applies to subscriptions made
+        after it is called."""
+        self._update_throttles[client_id] = _PerspectiveUpdateThrottle(
+            max_update_rate=max_update_rate,
+            call_later=call_later,
+            max_merged_rows=max_merged_rows,
+        )
+
+    def _pause_updates(self, client_id):
+        throttle = self._update_throttles.get(client_id, None)
+        if throttle is not None:
+            throttle.pause()
+
+    def _resume_updates(self, client_id):
+        throttle = self._update_throttles.get(client_id, None)
+        if throttle is not None:
+            if self._loop_callback:
+                self._loop_callback(throttle.resume)
+            else:
+                throttle.resume()
+
+    def _clear_update_throttle(self, client_id):
+        throttle = self._update_throttles.pop(client_id, None)
+        if throttle is not None:
+            throttle.clear()
+
+    def _make_update_coalescer(self, throttle, callback, view, args):
+        """Wrap the `on_update` callback of a throttled client, merging row
+        deltas on the table's index when the view is flat and shows it."""
+        index = None
+        mode = args[0].get("mode", "none") if len(args) > 0 else "none"
+        table_index = view._table._index
+
+        if (
+            mode == "row"
+            and table_index
+            and len(view._config.get_row_pivots()) == 0
+            and len(view._config.get_column_pivots()) == 0
+            and table_index in view._config.get_columns()
+        ):
+            index = table_index
+
+        coalescer = _PerspectiveUpdateCoalescer(throttle, callback, index=index)
+        throttle.add(coalescer)
+        return coalescer
+
+    def _remove_update_coalescer(self, client_id, callback):
+        throttle = self._update_throttles.get(client_id, None)
+        if throttle is not None and isinstance(callback, _PerspectiveUpdateCoalescer):
+            throttle.remove(callback)
+
+    def _frame_to_message(self, frame):
+        """Decode a binary frame from the client into a message. The frame's
+        payload, i.e. an arrow for `table` or `update`, becomes the first
+        argument of the message, and the message is flagged so that its
+        results are returned to the client as binary frames.
+        """
+        try:
+            frame = decode_frame(frame)
+        except ValueError as error:
+            raise PerspectiveError(str(error))
+
+        if frame.kind != FRAME_MESSAGE or not isinstance(frame.header, dict):
+            raise PerspectiveError(
+                "Binary frames passed into `_process` must be messages with a header."
+            )
+
+        msg = frame.header
+        msg["id"] = frame.id
+        msg["binary_protocol"] = True
+
+        if frame.payload is not None:
+            msg["args"] = [frame.payload] + msg.get("args", [])
+
+        return msg
+
+    def _post_message(self, msg, message, post_callback):
+        """Return `message`, the result of `msg`, to the client - as a binary
+        frame with a JSON header if `msg` was itself a binary frame, and as
+        JSON otherwise."""
+        if msg.get("binary_protocol"):
+            header = self._message_to_json(msg["id"], message)
+            post_callback(
+                encode_frame(FRAME_MESSAGE, msg["id"], header=header), binary=True
+            )
+        else:
+            post_callback(self._message_to_json(msg["id"], message))
+
     def _make_message(self, id, result):
         """Return a serializable message for a successful result."""
         return {"id": id, "data": result}
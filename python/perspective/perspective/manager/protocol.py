@@ -0,0 +1,132 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import json
+import struct
+
+# Binary frames begin with these magic bytes, which can never begin a JSON
+# message.
+FRAME_MAGIC = b"PSPB"
+FRAME_VERSION = 1
+
+# A method call or its result. The frame's header is the JSON message without
+# its binary argument or result, which is the frame's payload.
+FRAME_MESSAGE = 0
+
+# An `on_update` notification, which carries the `port_id` in the frame and
+# the row delta, if any, as the payload - there is no JSON header.
+FRAME_UPDATE = 1
+
+# magic, version, kind, reserved, id, port_id, header length, payload length
+_FRAME_STRUCT = struct.Struct("<4sBBHIiII")
+FRAME_PREFIX_LENGTH = _FRAME_STRUCT.size
+
+
+class PerspectiveFrame(object):
+    """A decoded binary frame of the manager protocol.
+
+    Attributes:
+        kind (:obj:`int`): `FRAME_MESSAGE` or `FRAME_UPDATE`.
+        id (:obj:`int`): the id of the message.
+        port_id (:obj:`int`): the port of an `on_update` notification.
+        header (:obj:`dict`): the JSON header, or `None`.
+        payload (:obj:`bytes`): the binary payload, i.e. an arrow, or `None`.
+    """
+
+    def __init__(self, kind, id, port_id=0, header=None, payload=None):
+        self.kind = kind
+        self.id = id
+        self.port_id = port_id
+        self.header = header
+        self.payload = payload
+
+
+def is_frame(message):
+    """Returns whether `message` is a binary frame of the manager protocol."""
+    return (
+        isinstance(message, (bytes, bytearray))
+        and message[: len(FRAME_MAGIC)] == FRAME_MAGIC
+    )
+
+
+def encode_frame(kind, id, header=None, payload=None, port_id=0):
+    """Encode a binary frame.
+
+    Args:
+        kind (:obj:`int`): `FRAME_MESSAGE` or `FRAME_UPDATE`.
+        id (:obj:`int`): the id of the message.
+
+    Keyword Args:
+        header (:obj:`str`): a JSON-serialized header.
+        payload (:obj:`bytes`): a binary payload, i.e. an arrow.
+        port_id (:obj:`int`): the port of an `on_update` notification.
+
+    Returns:
+        :obj:`bytes`
+    """
+    header = header.encode("utf-8") if header else b""
+    payload = payload or b""
+    prefix = _FRAME_STRUCT.pack(
+        FRAME_MAGIC,
+        FRAME_VERSION,
+        kind,
+        0,
+        id or 0,
+        port_id or 0,
+        len(header),
+        len(payload),
+    )
+    return b"".join((prefix, header, payload))
+
+
+def decode_frame(message):
+    """Decode a binary frame encoded by `encode_frame`.
+
+    Args:
+        message (:obj:`bytes`): a binary frame.
+
+    Returns:
+        :obj:`PerspectiveFrame`
+    """
+    if len(message) < FRAME_PREFIX_LENGTH:
+        raise ValueError("Binary frame is truncated.")
+
+    (
+        magic,
+        version,
+        kind,
+        _,
+        id,
+        port_id,
+        header_length,
+        payload_length,
+    ) = _FRAME_STRUCT.unpack_from(message)
+
+    if magic != FRAME_MAGIC or version != FRAME_VERSION:
+        raise ValueError("Unsupported binary frame version {}.".format(version))
+
+    header_end = FRAME_PREFIX_LENGTH + header_length
+    payload_end = header_end + payload_length
+
+    if len(message) != payload_end:
+        raise ValueError(
+            "Binary frame is {} bytes, but expected {}.".format(
+                len(message), payload_end
+            )
+        )
+
+    header = None
+    payload = None
+
+    if header_length > 0:
+        header = json.loads(bytes(message[FRAME_PREFIX_LENGTH:header_end]).decode("utf-8"))
+
+    if payload_length > 0:
+        payload = bytes(message[header_end:payload_end])
+
+    return PerspectiveFrame(kind, id, port_id, header, payload)
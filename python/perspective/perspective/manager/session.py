@@ -35,12 +35,49 @@ class PerspectiveSession(object):
         """
         self.manager._process(message, post_callback, client_id=self.client_id)
 
+    def set_update_throttle(
+        self, max_update_rate=None, call_later=None, max_merged_rows=100000
+    ):
+        """Coalesce the `on_update` notifications of this session's
+        subscriptions while it is paused, or when they would exceed
+        `max_update_rate`, into a single notification with the merged row
+        delta. Deltas which cannot be merged on the table's index, i.e. of
+        pivoted views, are dropped, and the client is only notified that the
+        view changed. Only applies to subscriptions made after it is called.
+
+        Keyword Args:
+            max_update_rate (:obj:`float`): The maximum number of
+                notifications per second for each subscription. Defaults to
+                `None`, which only coalesces while paused.
+            call_later (:obj:`callable`): A function which accepts a delay in
+                seconds and a function to call after it, i.e.
+                `IOLoop.call_later`. Required with `max_update_rate`.
+            max_merged_rows (:obj:`int`): The maximum number of rows merged
+                into a pending delta, past which it is dropped as well.
+        """
+        self.manager._set_update_throttle(
+            self.client_id,
+            max_update_rate=max_update_rate,
+            call_later=call_later,
+            max_merged_rows=max_merged_rows,
+        )
+
+    def pause_updates(self):
+        """Coalesce `on_update` notifications until `resume_updates()`, i.e.
+        while the client has not consumed the messages already sent to it."""
+        self.manager._pause_updates(self.client_id)
+
+    def resume_updates(self):
+        """Send the notifications coalesced since `pause_updates()`."""
+        self.manager._resume_updates(self.client_id)
+
     def close(self):
         """Remove the views and callbacks that were created within this session
         when the session ends.
         """
         self.manager.clear_views(self.client_id)
         self._clear_callbacks()
+        self.manager._clear_update_throttle(self.client_id)
 
     def _clear_callbacks(self):
         # remove all callbacks from the view's cache
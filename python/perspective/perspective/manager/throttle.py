@@ -0,0 +1,213 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import threading
+import time
+from ..core.exception import PerspectiveError
+from ..table import Table
+
+
+class _PerspectiveUpdateThrottle(object):
+    """The `on_update` backpressure state of a single client.
+
+    While a client is paused (i.e. its transport has not flushed the messages
+    already posted to it), or if it would exceed `max_update_rate`, the
+    notifications of its subscriptions are coalesced, and only the merged
+    result is sent once the client resumes or the rate allows.
+    """
+
+    def __init__(self, max_update_rate=None, call_later=None, max_merged_rows=100000):
+        """Create a throttle for a client.
+
+        Keyword Args:
+            max_update_rate (:obj:`float`): The maximum number of
+                notifications per second sent for each subscription, or
+                `None` to only coalesce while the client is paused.
+            call_later (:obj:`callable`): A function which accepts a delay in
+                seconds and a function, and calls the function after the
+                delay, i.e. `IOLoop.call_later`. Required if
+                `max_update_rate` is set. If the table has a processing
+                thread, it is called from that thread, so it must be
+                thread-safe, i.e. by wrapping `call_later` in
+                `IOLoop.add_callback`.
+            max_merged_rows (:obj:`int`): The maximum number of rows merged
+                into the pending delta of a subscription. Past it, the delta
+                is dropped and the client is only notified that the view
+                changed.
+        """
+        if max_update_rate is not None:
+            if max_update_rate <= 0:
+                raise PerspectiveError("`max_update_rate` must be positive.")
+            if call_later is None:
+                raise PerspectiveError(
+                    "`call_later` is required to throttle updates to a `max_update_rate`."
+                )
+
+        if max_merged_rows is not None and max_merged_rows <= 0:
+            raise PerspectiveError("`max_merged_rows` must be positive.")
+
+        self.min_interval = 1.0 / max_update_rate if max_update_rate else 0
+        self.call_later = call_later
+        self.max_merged_rows = max_merged_rows
+        self.paused = False
+        self._coalescers = []
+
+    def add(self, coalescer):
+        self._coalescers.append(coalescer)
+
+    def remove(self, coalescer):
+        if coalescer in self._coalescers:
+            self._coalescers.remove(coalescer)
+        coalescer.clear()
+
+    def pause(self):
+        self.paused = True
+
+    def resume(self):
+        """Unpause the client and send the pending notification of each of
+        its subscriptions."""
+        self.paused = False
+        for coalescer in list(self._coalescers):
+            coalescer.flush()
+
+    def clear(self):
+        for coalescer in self._coalescers:
+            coalescer.clear()
+        self._coalescers = []
+
+
+class _PerspectiveUpdateCoalescer(object):
+    """An `on_update` callback that forwards notifications to `send` as they
+    arrive while its client keeps up, and otherwise merges them into a
+    single pending notification.
+
+    Row deltas are merged into a `Table` on `index` if the view shows the
+    index column of a flat view, so only the latest value of each row is
+    kept. Other deltas, e.g. of pivoted views, cannot be merged, so they are
+    dropped, as is a merged delta past the throttle's `max_merged_rows`, and
+    the pending notification is then sent without a delta, i.e. the client
+    only learns that the view changed. Pending notifications only keep the
+    latest `port_id`.
+
+    Notifications arrive on the table's processing thread if it has one,
+    while the client is resumed and timers fire on the loop, so the pending
+    state is guarded by a lock, which is also held while sending so that
+    notifications are sent in order.
+    """
+
+    def __init__(self, throttle, send, index=None):
+        self._throttle = throttle
+        self._send = send
+        self._index = index
+        self._last_sent = 0
+        self._scheduled = False
+        self._pending = False
+        self._port_id = None
+        self._merged = None
+        self._dropped = False
+        self._lock = threading.RLock()
+
+    def __call__(self, port_id, delta=None):
+        with self._lock:
+            self._receive(port_id, delta)
+
+    def _receive(self, port_id, delta):
+        elapsed = time.time() - self._last_sent
+
+        if (
+            not self._pending
+            and not self._throttle.paused
+            and elapsed >= self._throttle.min_interval
+        ):
+            self._send_now(port_id, delta)
+            return
+
+        self._pending = True
+        self._port_id = port_id
+
+        if delta is not None and not self._dropped:
+            if self._index is None:
+                self._drop()
+            elif self._merged is None:
+                self._merged = Table(delta, index=self._index)
+            else:
+                self._merged.update(delta)
+
+            max_rows = self._throttle.max_merged_rows
+            if (
+                self._merged is not None
+                and max_rows is not None
+                and self._merged.size() > max_rows
+            ):
+                self._drop()
+
+        if not self._throttle.paused:
+            self._flush()
+
+    def flush(self):
+        """Send the pending notification, if any, unless the client is
+        paused or the rate does not allow it yet, in which case it is sent
+        when it does."""
+        with self._lock:
+            self._flush()
+
+    def _flush(self):
+        if not self._pending or self._throttle.paused:
+            return
+
+        elapsed = time.time() - self._last_sent
+        if elapsed < self._throttle.min_interval:
+            # `call_later` is always set when `min_interval` is.
+            if not self._scheduled:
+                self._scheduled = True
+                self._throttle.call_later(
+                    self._throttle.min_interval - elapsed, self._on_timer
+                )
+            return
+
+        delta = None
+        if self._merged is not None:
+            view = self._merged.view()
+            delta = view.to_arrow()
+            view.delete()
+
+        port_id = self._port_id
+        self._clear()
+        self._send_now(port_id, delta)
+
+    def clear(self):
+        """Drop the pending notification."""
+        with self._lock:
+            self._clear()
+
+    def _clear(self):
+        if self._merged is not None:
+            self._merged.delete()
+        self._pending = False
+        self._port_id = None
+        self._merged = None
+        self._dropped = False
+
+    def _drop(self):
+        """Stop merging deltas until the pending notification is sent."""
+        if self._merged is not None:
+            self._merged.delete()
+        self._merged = None
+        self._dropped = True
+
+    def _on_timer(self):
+        with self._lock:
+            self._scheduled = False
+            self._flush()
+
+    def _send_now(self, port_id, delta):
+        self._last_sent = time.time()
+        if delta is None:
+            self._send(port_id)
+        else:
+            self._send(port_id, delta)
@@ -0,0 +1,17 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+from .publisher import PerspectiveReplicaPublisher  # noqa: F401
+from .mirror import PerspectiveReplicaMirror  # noqa: F401
+from .transport import PerspectiveLoopbackTransport  # noqa: F401
+
+__all__ = [
+    "PerspectiveReplicaPublisher",
+    "PerspectiveReplicaMirror",
+    "PerspectiveLoopbackTransport",
+]
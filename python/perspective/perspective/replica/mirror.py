@@ -0,0 +1,134 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+from six.moves import queue
+from ..core.exception import PerspectiveError
+from ..manager.protocol import decode_frame
+from ..table import Table
+
+
+class PerspectiveReplicaMirror(object):
+    """A read-only replica of a :class:`~perspective.Table`, kept up to date
+    by applying the log of a
+    :class:`~perspective.replica.PerspectiveReplicaPublisher`.
+
+    `table` is created by the first `snapshot` message, and should only be
+    read from - views can be created on it, or it can be hosted in a locked
+    :class:`~perspective.PerspectiveManager`. Messages must be received from
+    the thread that owns the mirror.
+    """
+
+    def __init__(self):
+        self.table = None
+        self._index = None
+        self._seq = None
+
+    @property
+    def seq(self):
+        """The sequence number of the last message applied, or `None`
+        before the first snapshot."""
+        return self._seq
+
+    def receive(self, message):
+        """Apply a message of the publisher's log.
+
+        Args:
+            message (:obj:`bytes`): A message from the publisher.
+        """
+        frame = decode_frame(message)
+        op = frame.header["op"]
+
+        if op == "snapshot":
+            self._apply_snapshot(frame)
+            return
+
+        if self.table is None:
+            raise PerspectiveError("Mirror received `{}` before a snapshot.".format(op))
+
+        if frame.id != self._seq + 1:
+            raise PerspectiveError(
+                "Mirror expected message {} but received {}.".format(
+                    self._seq + 1, frame.id
+                )
+            )
+
+        if op == "update":
+            if frame.payload is not None:
+                self._apply_update(frame)
+        elif op == "remove":
+            pkey_table = Table(frame.payload)
+            view = pkey_table.view()
+            pkeys = view.to_dict()[self._index]
+            view.delete()
+            pkey_table.delete()
+            self.table.remove(pkeys)
+        elif op == "clear":
+            self.table.clear()
+        else:
+            raise PerspectiveError("Mirror received unknown message `{}`.".format(op))
+
+        self._seq = frame.id
+
+    def drain(self, messages):
+        """Apply every message waiting in `messages`, a :obj:`queue.Queue`
+        (i.e. from `PerspectiveLoopbackTransport.connect()`), without
+        blocking.
+
+        Returns:
+            :obj:`int`: the number of messages applied.
+        """
+        count = 0
+        while True:
+            try:
+                message = messages.get_nowait()
+            except queue.Empty:
+                return count
+            self.receive(message)
+            count += 1
+
+    def _apply_update(self, frame):
+        pkeys = frame.header.get("index", None)
+        if self._index or pkeys is None:
+            self.table.update(frame.payload)
+            return
+
+        # Write each row of an unindexed table to its primary key, rather
+        # than appending it, as the publisher's row may have been written
+        # to an existing key with `__INDEX__`.
+        delta = Table(frame.payload)
+        view = delta.view()
+        data = view.to_columns()
+        view.delete()
+        delta.delete()
+        data["__INDEX__"] = pkeys
+        self.table.update(data)
+
+    def _apply_snapshot(self, frame):
+        header = frame.header
+        self._index = header["index"]
+        self._seq = frame.id
+
+        # Unindexed rows are keyed by the offset they were written at, and
+        # the snapshot is in key order, so it is written from offset 0 and
+        # the publisher's offset restored after - otherwise a `limit` table
+        # which has wrapped would overwrite different rows than the
+        # publisher's.
+        if self.table is None:
+            self.table = Table(
+                frame.payload,
+                index=header["index"],
+                limit=header["limit"],
+                expire_column=header["expire_column"],
+                expire_after=header["expire_after"],
+            )
+        else:
+            # Keep the views of the existing replica.
+            self.table._table.set_offset(0)
+            self.table.replace(frame.payload)
+
+        self.table._table.set_offset(header["offset"])
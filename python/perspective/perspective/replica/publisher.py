@@ -0,0 +1,152 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import json
+import threading
+from ..core.exception import PerspectiveError
+from ..manager.protocol import FRAME_MESSAGE, encode_frame
+from ..table import Table
+
+
+class PerspectiveReplicaPublisher(object):
+    """Publishes the changes to a :class:`~perspective.Table` as an ordered
+    log, which :class:`~perspective.replica.PerspectiveReplicaMirror`
+    instances apply to read-only replicas of the table, i.e. to serve views
+    from other threads or processes.
+
+    Each message of the log is a binary frame (see
+    `perspective.manager.protocol`) whose id is its sequence number, and
+    whose header names the operation:
+
+    - `snapshot`: the table's full dataset as an arrow, with its `index`,
+        `limit`, expiry and the `offset` its next unindexed rows are
+        written at. Sent to each subscriber when it subscribes.
+    - `update`: the rows changed by a `process()` as an arrow - the row
+        delta of a flat view over every column, so each row is the merged
+        result of the update rather than its input. If the table has no
+        `index`, the header's `index` lists the primary key of each row,
+        as rows may be written to any key with `__INDEX__`.
+    - `remove`: the removed primary keys as an arrow.
+    - `clear`: the table was cleared, i.e. by `clear()` or `replace()`.
+
+    Each change is serialized once, however many subscribers there are.
+    Updates are only published once the table processes them. Messages are
+    numbered and sent under a lock, so they reach each subscriber in order
+    if the table is processed on another thread.
+
+    Examples:
+        >>> publisher = PerspectiveReplicaPublisher(table)
+        >>> mirror = PerspectiveReplicaMirror()
+        >>> publisher.subscribe(mirror.receive)
+        >>> mirror.table.view().to_dict()
+    """
+
+    def __init__(self, table):
+        """Start replicating `table`, which can only have one publisher.
+
+        Args:
+            table (:obj:`~perspective.Table`): The primary table.
+        """
+        if table._publisher is not None:
+            raise PerspectiveError("Table is already replicated by a publisher.")
+
+        self._table = table
+        self._seq = 0
+        self._subscribers = []
+        self._lock = threading.RLock()
+        self._view = table.view()
+
+        # The row delta is read by `_on_update` itself, so the primary keys
+        # of an unindexed table's rows can be read before it is cleared.
+        self._view._view._set_deltas_enabled(True)
+        self._view.on_update(self._on_update)
+        table._publisher = self
+
+    def subscribe(self, send):
+        """Send a snapshot of the table to `send`, and then every message
+        of the log after it.
+
+        Args:
+            send (:obj:`callable`): A function which delivers a message
+                (:obj:`bytes`) to a mirror, in order.
+        """
+        snapshot = self.snapshot()
+        with self._lock:
+            send(snapshot)
+            self._subscribers.append(send)
+
+    def unsubscribe(self, send):
+        """Stop sending messages to `send`."""
+        with self._lock:
+            if send in self._subscribers:
+                self._subscribers.remove(send)
+
+    def snapshot(self):
+        """Returns a `snapshot` message of the table, after the pending
+        updates have been processed and published.
+
+        Returns:
+            :obj:`bytes`
+        """
+        self._table._state_manager.call_process(self._table._table.get_id())
+        header = {
+            "op": "snapshot",
+            "index": self._table._index,
+            "limit": self._table._limit,
+            "offset": self._table._table.get_offset(),
+            "expire_column": self._table._expire_column,
+            "expire_after": self._table._expire_after,
+        }
+        payload = self._view.to_arrow()
+        with self._lock:
+            seq = self._seq
+        return encode_frame(
+            FRAME_MESSAGE, seq, header=json.dumps(header), payload=payload
+        )
+
+    def delete(self):
+        """Stop replicating the table."""
+        self._view.remove_update(self._on_update)
+        self._view.delete()
+        with self._lock:
+            self._subscribers = []
+        self._table._publisher = None
+
+    def _publish(self, op, payload=None, **header):
+        header["op"] = op
+        with self._lock:
+            self._seq += 1
+            message = encode_frame(
+                FRAME_MESSAGE, self._seq, header=json.dumps(header), payload=payload
+            )
+
+            for send in list(self._subscribers):
+                send(message)
+
+    def _on_update(self, port_id):
+        if self._table._index:
+            self._publish("update", self._view._get_row_delta())
+        else:
+            pkeys = self._view._get_row_delta_pkeys()
+            self._publish("update", self._view._get_row_delta(), index=pkeys)
+
+    def _on_remove(self, pkeys):
+        # Removes are published as soon as they are queued. As an `update`
+        # only has the rows that exist once it is processed, a remove is
+        # never undone by a later `update` for rows it had already removed.
+        index = self._table._index
+        pkey_table = Table({index: self._table.schema()[index]})
+        pkey_table.update({index: pkeys})
+        view = pkey_table.view()
+        arrow = view.to_arrow()
+        view.delete()
+        pkey_table.delete()
+        self._publish("remove", arrow)
+
+    def _on_clear(self):
+        self._publish("clear")
@@ -0,0 +1,39 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+from six.moves import queue
+
+
+class PerspectiveLoopbackTransport(object):
+    """Connects :class:`~perspective.replica.PerspectiveReplicaMirror`
+    instances to a publisher in the same process. Each connection has its
+    own queue, so each mirror can drain it from the thread that owns it.
+
+    Examples:
+        >>> transport = PerspectiveLoopbackTransport(publisher)
+        >>> messages = transport.connect()
+        >>> # in the mirror's thread
+        >>> mirror.drain(messages)
+    """
+
+    def __init__(self, publisher):
+        self._publisher = publisher
+
+    def connect(self):
+        """Subscribe a new queue to the publisher, starting with a snapshot.
+
+        Returns:
+            :obj:`queue.Queue`: the publisher's messages, in order.
+        """
+        messages = queue.Queue()
+        self._publisher.subscribe(messages.put)
+        return messages
+
+    def disconnect(self, messages):
+        """Unsubscribe a queue returned by `connect()`."""
+        self._publisher.unsubscribe(messages.put)
@@ -60,6 +60,7 @@ make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
     auto cfg = t_config(columns, fterm, filter_op, computed_columns);
     auto ctx0 = std::make_shared<t_ctx0>(*(schema.get()), cfg);
     ctx0->init();
+    ctx0->set_limit(view_config->get_limit());
     ctx0->sort_by(sortspec);
 
     auto pool = table->get_pool();
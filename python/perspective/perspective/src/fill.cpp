@@ -10,6 +10,7 @@
 
 #include <perspective/base.h>
 #include <perspective/binding.h>
+#include <perspective/data_loader.h>
 #include <perspective/python/base.h>
 #include <perspective/python/fill.h>
 #include <perspective/python/utils.h>
@@ -17,6 +18,179 @@
 namespace perspective {
 namespace binding {
 
+/******************************************************************************
+ *
+ * Native reads from `dict` and `list` datasets
+ */
+
+/**
+ * @brief Reads one column of a `_PerspectiveAccessor` over a dict of lists or
+ * a list of dicts, walking the Python containers directly.
+ *
+ * Values that `marshal` would return unchanged - `None`, and `str`, `int`,
+ * `float` and `bool` going into a column of the same kind - are read without
+ * calling into Python, and `int`/`float` are converted between each other
+ * natively. Everything else, i.e. date strings or objects with `_psp_repr_`,
+ * still goes through `accessor.marshal`.
+ */
+class t_py_column_reader {
+public:
+    t_py_column_reader(t_data_accessor accessor, const std::string& name, std::int32_t cidx, t_dtype type)
+        : m_native(false)
+        , m_has_column(true)
+        , m_format(-1)
+        , m_cidx(cidx)
+        , m_type(type)
+        , m_name(name)
+        , m_marshal(accessor.attr("marshal"))
+        , m_has_column_fn(accessor.attr("_has_column")) {
+        // Reserved columns are looked up by a different name than they are
+        // stored under, and dates need the accessor's date validator.
+        bool is_reserved = name == "psp_pkey" || name == "psp_okey" || name == "psp_op";
+        bool is_native_type = type != DTYPE_DATE && type != DTYPE_TIME && type != DTYPE_OBJECT;
+
+        if (is_reserved || !is_native_type || accessor.attr("_is_numpy").cast<bool>()) {
+            return;
+        }
+
+        py::list names = accessor.attr("_names");
+        if (cidx < 0 || static_cast<std::size_t>(cidx) >= names.size()) {
+            return;
+        }
+
+        m_format = accessor.attr("_format").cast<std::int32_t>();
+        m_data = accessor.attr("_data_or_schema");
+        m_key = names[cidx];
+        m_name_key = py::str(name);
+
+        if (m_format == 0) {
+            m_native = PyList_CheckExact(m_data.ptr());
+        } else if (m_format == 1 && PyDict_CheckExact(m_data.ptr())) {
+            m_has_column = PyDict_Contains(m_data.ptr(), m_name_key.ptr()) == 1;
+            PyObject* column = PyDict_GetItem(m_data.ptr(), m_key.ptr());
+            if (column == nullptr) {
+                m_column = py::none();
+                m_native = true;
+            } else if (PyList_CheckExact(column)) {
+                m_column = py::reinterpret_borrow<py::object>(column);
+                m_native = true;
+            }
+        }
+    }
+
+    /**
+     * @brief Whether the row at `ridx` contains this column - see
+     * `_PerspectiveAccessor._has_column`.
+     */
+    bool
+    has_column(t_uindex ridx) const {
+        if (m_native && m_format == 1) {
+            return m_has_column;
+        } else if (m_native) {
+            PyObject* row = get_row(ridx);
+            if (row != nullptr) {
+                return PyDict_Contains(row, m_name_key.ptr()) == 1;
+            }
+        }
+
+        return m_has_column_fn(ridx, m_name).cast<bool>();
+    }
+
+    /**
+     * @brief Returns the value at `ridx`, marshalled as
+     * `_PerspectiveAccessor.marshal` would for this column's type.
+     */
+    t_val
+    marshal(t_uindex ridx) const {
+        if (!m_native) {
+            return m_marshal(m_cidx, ridx, m_type);
+        }
+
+        PyObject* value = nullptr;
+
+        if (m_format == 1) {
+            // missing columns and rows past the end of a list are `None`
+            if (m_column.is_none() || ridx >= static_cast<t_uindex>(PyList_GET_SIZE(m_column.ptr()))) {
+                return py::none();
+            }
+            value = PyList_GET_ITEM(m_column.ptr(), ridx);
+        } else {
+            PyObject* row = get_row(ridx);
+            if (row == nullptr) {
+                return m_marshal(m_cidx, ridx, m_type);
+            }
+            value = PyDict_GetItem(row, m_key.ptr());
+            if (value == nullptr) {
+                return py::none();
+            }
+        }
+
+        if (value == Py_None) {
+            return py::none();
+        }
+
+        bool is_int_type = m_type == DTYPE_INT8 || m_type == DTYPE_INT16 || m_type == DTYPE_INT32 || m_type == DTYPE_INT64
+            || m_type == DTYPE_UINT8 || m_type == DTYPE_UINT16 || m_type == DTYPE_UINT32 || m_type == DTYPE_UINT64;
+        bool is_float_type = m_type == DTYPE_FLOAT32 || m_type == DTYPE_FLOAT64;
+
+        if (PyFloat_CheckExact(value)) {
+            double fval = PyFloat_AS_DOUBLE(value);
+            if (std::isnan(fval)) {
+                return py::none();
+            } else if (is_float_type) {
+                return py::reinterpret_borrow<py::object>(value);
+            } else if (is_int_type) {
+                // Infinite values raise `OverflowError`
+                PyObject* ival = PyLong_FromDouble(fval);
+                if (ival == nullptr) {
+                    throw py::error_already_set();
+                }
+                return py::reinterpret_steal<py::object>(ival);
+            }
+        } else if (PyLong_CheckExact(value)) {
+            if (is_int_type) {
+                return py::reinterpret_borrow<py::object>(value);
+            } else if (is_float_type) {
+                PyObject* fval = PyNumber_Float(value);
+                if (fval == nullptr) {
+                    throw py::error_already_set();
+                }
+                return py::reinterpret_steal<py::object>(fval);
+            }
+        } else if (PyUnicode_CheckExact(value) && m_type == DTYPE_STR) {
+            return py::reinterpret_borrow<py::object>(value);
+        } else if (PyBool_Check(value) && m_type == DTYPE_BOOL) {
+            return py::reinterpret_borrow<py::object>(value);
+        }
+
+        return m_marshal(m_cidx, ridx, m_type);
+    }
+
+private:
+    // The row at `ridx` of a list of dicts, or `nullptr` if it is not a `dict`.
+    PyObject*
+    get_row(t_uindex ridx) const {
+        if (ridx >= static_cast<t_uindex>(PyList_GET_SIZE(m_data.ptr()))) {
+            return nullptr;
+        }
+        PyObject* row = PyList_GET_ITEM(m_data.ptr(), ridx);
+        return PyDict_CheckExact(row) ? row : nullptr;
+    }
+
+    bool m_native;
+    bool m_has_column;
+    std::int32_t m_format;
+    std::int32_t m_cidx;
+    t_dtype m_type;
+    std::string m_name;
+    py::object m_marshal;
+    py::object m_has_column_fn;
+    py::object m_data;
+    py::object m_key;
+    py::object m_name_key;
+    py::object m_column;
+};
+
 /******************************************************************************
  *
  * Fill columns with data
@@ -26,20 +200,17 @@ void
 _fill_col_time(t_data_accessor accessor, std::shared_ptr<t_column> col, std::string name,
     std::int32_t cidx, t_dtype type, bool is_update) {
     t_uindex nrows = col->size();
+    t_py_column_reader reader(accessor, name, cidx, type);
 
     for (auto i = 0; i < nrows; ++i) {
-        if (!accessor.attr("_has_column")(i, name).cast<bool>()) {
+        if (!reader.has_column(i)) {
             continue;
         }
 
-        t_val item = accessor.attr("marshal")(cidx, i, type);
+        t_val item = reader.marshal(i);
 
         if (item.is_none()) {
-            if (is_update) {
-                col->unset(i);
-            } else {
-                col->clear(i);
-            }
+            t_data_loader::fill_null(*col, i, is_update);
             continue;
         }
 
@@ -51,20 +222,17 @@ void
 _fill_col_date(t_data_accessor accessor, std::shared_ptr<t_column> col, std::string name,
     std::int32_t cidx, t_dtype type, bool is_update) {
     t_uindex nrows = col->size();
+    t_py_column_reader reader(accessor, name, cidx, type);
 
     for (auto i = 0; i < nrows; ++i) {
-        if (!accessor.attr("_has_column")(i, name).cast<bool>()) {
+        if (!reader.has_column(i)) {
             continue;
         }
 
-        t_val item = accessor.attr("marshal")(cidx, i, type);
+        t_val item = reader.marshal(i);
 
         if (item.is_none()) {
-            if (is_update) {
-                col->unset(i);
-            } else {
-                col->clear(i);
-            }
+            t_data_loader::fill_null(*col, i, is_update);
             continue;
         }
 
@@ -79,20 +247,17 @@ void
 _fill_col_bool(t_data_accessor accessor, std::shared_ptr<t_column> col, std::string name,
     std::int32_t cidx, t_dtype type, bool is_update) {
     t_uindex nrows = col->size();
+    t_py_column_reader reader(accessor, name, cidx, type);
 
     for (auto i = 0; i < nrows; ++i) {
-        if (!accessor.attr("_has_column")(i, name).cast<bool>()) {
+        if (!reader.has_column(i)) {
             continue;
         }
 
-        t_val item = accessor.attr("marshal")(cidx, i, type);
+        t_val item = reader.marshal(i);
 
         if (item.is_none()) {
-            if (is_update) {
-                col->unset(i);
-            } else {
-                col->clear(i);
-            }
+            t_data_loader::fill_null(*col, i, is_update);
             continue;
         }
 
@@ -104,22 +269,18 @@ _fill_col_bool(t_data_accessor accessor, std::shared_ptr<t_column> col, std::str
 void
 _fill_col_string(t_data_accessor accessor, std::shared_ptr<t_column> col, std::string name,
     std::int32_t cidx, t_dtype type, bool is_update) {
-
     t_uindex nrows = col->size();
+    t_py_column_reader reader(accessor, name, cidx, type);
 
     for (auto i = 0; i < nrows; ++i) {
-        if (!accessor.attr("_has_column")(i, name).cast<bool>()) {
+        if (!reader.has_column(i)) {
             continue;
         }
 
-        t_val item = accessor.attr("marshal")(cidx, i, type);
+        t_val item = reader.marshal(i);
 
         if (item.is_none()) {
-            if (is_update) {
-                col->unset(i);
-            } else {
-                col->clear(i);
-            }
+            t_data_loader::fill_null(*col, i, is_update);
             continue;
         }
 
@@ -194,20 +355,17 @@ void
 _fill_col_numeric(t_data_accessor accessor, t_data_table& tbl,
     std::shared_ptr<t_column> col, std::string name, std::int32_t cidx, t_dtype type, bool is_update) {
     t_uindex nrows = col->size();
+    t_py_column_reader reader(accessor, name, cidx, type);
 
     for (auto i = 0; i < nrows; ++i) {
-        if (!accessor.attr("_has_column")(i, name).cast<bool>()) {
+        if (!reader.has_column(i)) {
             continue;
         }
 
-        t_val item = accessor.attr("marshal")(cidx, i, type);
+        t_val item = reader.marshal(i);
 
         if (item.is_none()) {
-            if (is_update) {
-                col->unset(i);
-            } else {
-                col->clear(i);
-            }
+            t_data_loader::fill_null(*col, i, is_update);
             continue;
         }
 
@@ -237,7 +395,12 @@ _fill_col_numeric(t_data_accessor accessor, t_data_table& tbl,
 
                 // First we need to see if we can cast to double
                 double fval;
-                if (!py::hasattr(item, "__float__")) {
+                if (PyLong_CheckExact(item.ptr())) {
+                    fval = PyLong_AsDouble(item.ptr());
+                    if (fval == -1.0 && PyErr_Occurred()) {
+                        throw py::error_already_set();
+                    }
+                } else if (!py::hasattr(item, "__float__")) {
                     if (py::hasattr(item, "__int__")) {
                         // promote from int
                         fval = static_cast<double>(item.cast<int>());
@@ -251,14 +414,13 @@ _fill_col_numeric(t_data_accessor accessor, t_data_table& tbl,
 
                 if (!is_update && (fval > 2147483647 || fval < -2147483648)) {
                     WARN("Promoting column `%s` to float from int32", name);
-                    tbl.promote_column(name, DTYPE_FLOAT64, i, true);
-                    col = tbl.get_column(name);
+                    col = t_data_loader::promote_column(tbl, name, DTYPE_FLOAT64, i, true);
                     type = DTYPE_FLOAT64;
+                    reader = t_py_column_reader(accessor, name, cidx, type);
                     col->set_nth(i, fval);
                 } else if (!is_update && isnan(fval)) {
                     WARN("Promoting column `%s` to string from int32", name);
-                    tbl.promote_column(name, DTYPE_STR, i, false);
-                    col = tbl.get_column(name);
+                    col = t_data_loader::promote_column(tbl, name, DTYPE_STR, i, false);
                     _fill_col_string(
                         accessor, col, name, cidx, DTYPE_STR, is_update);
                     return;
@@ -267,6 +429,17 @@ _fill_col_numeric(t_data_accessor accessor, t_data_table& tbl,
                 }
             } break;
             case DTYPE_INT64: {
+                // Python ints are read exactly, rather than through a double
+                if (PyLong_CheckExact(item.ptr())) {
+                    int overflow = 0;
+                    long long ival = PyLong_AsLongLongAndOverflow(item.ptr(), &overflow);
+                    if (overflow == 0 && !(ival == -1 && PyErr_Occurred())) {
+                        col->set_nth(i, static_cast<std::int64_t>(ival));
+                        break;
+                    }
+                    PyErr_Clear();
+                }
+
                 // First we need to see if we can cast to double
                 double fval;
                 if (!py::hasattr(item, "__float__")) {
@@ -283,8 +456,7 @@ _fill_col_numeric(t_data_accessor accessor, t_data_table& tbl,
 
                 if (!is_update && isnan(fval)) {
                     WARN("Promoting column `%s` to string from int64", name);
-                    tbl.promote_column(name, DTYPE_STR, i, false);
-                    col = tbl.get_column(name);
+                    col = t_data_loader::promote_column(tbl, name, DTYPE_STR, i, false);
                     _fill_col_string(
                         accessor, col, name, cidx, DTYPE_STR, is_update);
                     return;
@@ -296,6 +468,12 @@ _fill_col_numeric(t_data_accessor accessor, t_data_table& tbl,
                 col->set_nth(i, item.cast<float>());
             } break;
             case DTYPE_FLOAT64: {
+                // `nan` has already been marshalled to `None`
+                if (PyFloat_CheckExact(item.ptr())) {
+                    col->set_nth(i, PyFloat_AS_DOUBLE(item.ptr()));
+                    break;
+                }
+
                 bool is_float = py::isinstance<py::float_>(item) || py::hasattr(item, "__float__") || py::hasattr(item, "__int__");
 
                 bool is_numpy_nan = false;
@@ -305,8 +483,7 @@ _fill_col_numeric(t_data_accessor accessor, t_data_table& tbl,
 
                 if (!is_update && (!is_float || is_numpy_nan)) {
                     WARN("Promoting column `%s` to string from float64", name);
-                    tbl.promote_column(name, DTYPE_STR, i, false);
-                    col = tbl.get_column(name);
+                    col = t_data_loader::promote_column(tbl, name, DTYPE_STR, i, false);
                     _fill_col_string(
                         accessor, col, name, cidx, DTYPE_STR, is_update);
                     return;
@@ -367,44 +544,31 @@ _fill_data_helper(t_data_accessor accessor, t_data_table& tbl,
  * Fill tables with data
  */
 
+/**
+ * @brief Fills a `t_data_table` from a `_PerspectiveAccessor` over Python dicts and lists, one
+ * `_fill_data_helper` call per column.
+ */
+class t_accessor_loader : public t_data_loader {
+public:
+    t_accessor_loader(t_data_accessor accessor)
+        : m_accessor(accessor) {}
+
+protected:
+    void
+    fill_column(t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name,
+        const t_loader_column& source, bool is_update) override {
+        _fill_data_helper(m_accessor, tbl, col, name, source.m_cidx, source.m_type, is_update);
+    }
+
+private:
+    t_data_accessor m_accessor;
+};
+
 void
 _fill_data(t_data_table& tbl, t_data_accessor accessor, const t_schema& input_schema,
-           const std::string& index, std::uint32_t offset, std::uint32_t limit, bool is_update) {
-    bool implicit_index = false;
-    std::vector<std::string> col_names(input_schema.columns());
-    std::vector<t_dtype> data_types(input_schema.types());
-
-    for (auto cidx = 0; cidx < col_names.size(); ++cidx) {
-        auto name = col_names[cidx];
-        auto type = data_types[cidx];
-
-        if (name == "__INDEX__") {
-            implicit_index = true;
-            std::shared_ptr<t_column> pkey_col_sptr = tbl.add_column_sptr("psp_pkey", type, true);
-            _fill_data_helper(accessor, tbl, pkey_col_sptr, "psp_pkey", cidx, type, is_update);
-            tbl.clone_column("psp_pkey", "psp_okey");
-            continue;
-         }
-
-        auto col = tbl.get_column(name);
-        _fill_data_helper(accessor, tbl, col, name, cidx, type, is_update);
-    }
-    // Fill index column - recreated every time a `t_data_table` is created.
-    if (!implicit_index) {
-        if (index == "") {
-            // Use row number as index if not explicitly provided or provided with `__INDEX__`
-            auto key_col = tbl.add_column("psp_pkey", DTYPE_INT32, true);
-            auto okey_col = tbl.add_column("psp_okey", DTYPE_INT32, true);
-
-            for (std::uint32_t ridx = 0; ridx < tbl.size(); ++ridx) {
-                key_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
-                okey_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
-            }
-        } else {
-            tbl.clone_column(index, "psp_pkey");
-            tbl.clone_column(index, "psp_okey");
-        }
-    }
+    const std::string& index, std::uint32_t offset, std::uint32_t limit, bool is_update) {
+    t_accessor_loader loader(accessor);
+    loader.fill_table(tbl, input_schema, index, offset, limit, is_update);
 }
 
 } //namespace binding
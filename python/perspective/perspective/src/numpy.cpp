@@ -7,6 +7,7 @@
  *
  */
 #ifdef PSP_ENABLE_PYTHON
+#include <perspective/pyutils.h>
 #include <perspective/python/fill.h>
 #include <perspective/python/numpy.h>
 
@@ -17,6 +18,33 @@ namespace numpy {
 
     const std::vector<std::string> NumpyLoader::DATE_UNITS = {"[D]", "[W]", "[M]", "[Y]"};
 
+    // numpy represents `NaT` as the smallest int64.
+    static const std::int64_t NUMPY_NAT = std::numeric_limits<std::int64_t>::min();
+
+    static inline std::int64_t
+    floor_div(std::int64_t a, std::int64_t b) {
+        std::int64_t q = a / b;
+        return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+    }
+
+    /**
+     * Convert days since epoch into a proleptic Gregorian year, month [0-11]
+     * and day, as `t_date` expects them.
+     */
+    static inline t_date
+    days_to_date(std::int64_t days) {
+        days += 719468;
+        std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+        std::int64_t doe = days - era * 146097;
+        std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        std::int64_t mp = (5 * doy + 2) / 153;
+        std::int64_t day = doy - (153 * mp + 2) / 5 + 1;
+        std::int64_t month = mp < 10 ? mp + 2 : mp - 10;
+        std::int64_t year = yoe + era * 400 + (month <= 1);
+        return t_date(static_cast<std::int16_t>(year), static_cast<std::int8_t>(month), static_cast<std::int8_t>(day));
+    }
+
     NumpyLoader::NumpyLoader(t_val accessor)
         : m_init(false)
         , m_accessor(accessor) {}
@@ -83,45 +111,9 @@ namespace numpy {
     }
 
     void
-    NumpyLoader::fill_table(t_data_table& tbl, const t_schema& input_schema,
-        const std::string& index, std::uint32_t offset, std::uint32_t limit, bool is_update) {
-        PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
-        bool implicit_index = false;
-        std::vector<std::string> col_names(input_schema.columns());
-        std::vector<t_dtype> data_types(input_schema.types());
-
-        for (auto cidx = 0; cidx < col_names.size(); ++cidx) {
-            auto name = col_names[cidx];
-            auto type = data_types[cidx];
-
-            if (name == "__INDEX__") {
-                implicit_index = true;
-                std::shared_ptr<t_column> pkey_col_sptr = tbl.add_column_sptr("psp_pkey", type, true);
-                fill_column(tbl, pkey_col_sptr, "__INDEX__", type, cidx, is_update);
-                tbl.clone_column("psp_pkey", "psp_okey");
-                continue;
-            }
-
-            auto col = tbl.get_column(name);
-            fill_column(tbl, col, name, type, cidx, is_update);
-        }
-
-        // Fill index column - recreated every time a `t_data_table` is created.
-        if (!implicit_index) {
-            if (index == "") {
-                // Use row number as index if not explicitly provided or provided with `__INDEX__`
-                auto key_col = tbl.add_column("psp_pkey", DTYPE_INT32, true);
-                auto okey_col = tbl.add_column("psp_okey", DTYPE_INT32, true);
-
-                for (std::uint32_t ridx = 0; ridx < tbl.size(); ++ridx) {
-                    key_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
-                    okey_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
-                }
-            } else {
-                tbl.clone_column(index, "psp_pkey");
-                tbl.clone_column(index, "psp_okey");
-            }
-        }
+    NumpyLoader::fill_column(t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name,
+        const t_loader_column& source, bool is_update) {
+        fill_column(tbl, col, source.m_name, source.m_type, source.m_cidx, is_update);
     }
 
     
@@ -154,8 +146,27 @@ namespace numpy {
             return;
         }
 
-        // Datetimes are not trivially copyable - they are float64 values that need to be read as int64
-        if (type == DTYPE_TIME || type == DTYPE_DATE) {
+        bool is_date_type = type == DTYPE_TIME || type == DTYPE_DATE;
+
+        // `datetime64` arrays keep their unit, and are converted here.
+        if (array.dtype().kind() == 'M' && is_date_type) {
+            if (fill_datetime64(array, col, type, is_update) == t_fill_status::FILL_FAIL) {
+                if (type == DTYPE_DATE) {
+                    fill_date_iter(col, name, np_dtype, type, cidx, is_update);
+                } else {
+                    fill_object_iter<std::int64_t>(tbl, col, name, np_dtype, type, cidx, is_update);
+                }
+                fill_validity_map(col, mask_ptr, mask_size, is_update);
+            }
+            return;
+        } else if (array.dtype().kind() == 'M') {
+            fill_column_iter(array, tbl, col, name, DTYPE_OBJECT, type, cidx, is_update);
+            fill_validity_map(col, mask_ptr, mask_size, is_update);
+            return;
+        }
+
+        // Dates and datetimes from other dtypes, i.e. integer timestamps, are read through `marshal`.
+        if (is_date_type) {
             fill_column_iter(array, tbl, col, name, np_dtype, type, cidx, is_update);
             fill_validity_map(col, mask_ptr, mask_size, is_update);
             return;
@@ -177,8 +188,8 @@ namespace numpy {
             (type == DTYPE_INT64 && (np_dtype == DTYPE_FLOAT32 || np_dtype == DTYPE_FLOAT64));
 
         if (should_iter) {
-            // Skip straight to numeric fill
-            fill_numeric_iter(array, tbl, col, name, np_dtype, type, cidx, is_update);
+            fill_numeric_convert(array, tbl, col, name, np_dtype, type, is_update);
+            fill_validity_map(col, mask_ptr, mask_size, is_update);
             return;
         }
 
@@ -202,11 +213,7 @@ namespace numpy {
             t_val item = m_accessor.attr("marshal")(cidx, i, type);
 
             if (item.is_none()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -224,25 +231,19 @@ namespace numpy {
             t_val item = m_accessor.attr("marshal")(cidx, i, type);
 
             if (item.is_none()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                fill_null(*col, i, is_update);
                 continue;
             }
 
             double fval = item.cast<double>();
             if (!is_update && (fval > 2147483647 || fval < -2147483648)) {
                 binding::WARN("Promoting column `%s` to float from int32", name);
-                tbl.promote_column(name, DTYPE_FLOAT64, i, true);
-                col = tbl.get_column(name);
+                col = promote_column(tbl, name, DTYPE_FLOAT64, i, true);
                 type = DTYPE_FLOAT64;
                 col->set_nth(i, fval);
             } else if (!is_update && isnan(fval)) {
                 binding::WARN("Promoting column `%s` to string from int32", name);
-                tbl.promote_column(name, DTYPE_STR, i, false);
-                col = tbl.get_column(name);
+                col = promote_column(tbl, name, DTYPE_STR, i, false);
                 fill_object_iter<std::string>(
                     tbl, col, name, np_dtype, DTYPE_STR, cidx, is_update);
                 return;
@@ -261,19 +262,14 @@ namespace numpy {
             t_val item = m_accessor.attr("marshal")(cidx, i, type);
 
             if (item.is_none()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                fill_null(*col, i, is_update);
                 continue;
             }
 
             double fval = item.cast<double>();
             if (isnan(fval)) {
                 binding::WARN("Promoting column `%s` to string from int64", name);
-                tbl.promote_column(name, DTYPE_STR, i, false);
-                col = tbl.get_column(name);
+                col = promote_column(tbl, name, DTYPE_STR, i, false);
                 fill_object_iter<std::string>(
                     tbl, col, name, np_dtype, DTYPE_STR, cidx, is_update);
                 return;
@@ -292,11 +288,7 @@ namespace numpy {
             t_val item = m_accessor.attr("marshal")(cidx, i, type);
 
             if (item.is_none()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -304,8 +296,7 @@ namespace numpy {
             bool is_numpy_nan = is_float && npy_isnan(item.cast<double>());
             if (!is_float || is_numpy_nan) {
                 binding::WARN("Promoting column `%s` to string from float64", name);
-                tbl.promote_column(name, DTYPE_STR, i, false);
-                col = tbl.get_column(name);
+                col = promote_column(tbl, name, DTYPE_STR, i, false);
                 fill_object_iter<std::string>(
                     tbl, col, name, np_dtype, DTYPE_STR, cidx, is_update);
                 return;
@@ -322,15 +313,11 @@ namespace numpy {
         // but if they're of dtype object, then we need to pass it through `m_accessor.marshal`.
         switch (type) {
             case DTYPE_TIME: {
-                // covers dtype `datetime64[us/ns/ms/s]`, date strings, and integer timestamps in ms or s since epoch
-                if (np_dtype != DTYPE_TIME) {
-                    fill_object_iter<std::int64_t>(tbl, col, name, np_dtype, type, cidx, is_update);
-                } else {
-                    fill_datetime_iter(array, tbl, col, name, np_dtype, type, cidx, is_update);
-                }
+                // date strings, and integer timestamps in ms or s since epoch - `datetime64` arrays are filled by `fill_datetime64`
+                fill_object_iter<std::int64_t>(tbl, col, name, np_dtype, type, cidx, is_update);
             } break;
             case DTYPE_DATE: {
-                // `datetime.date` objects or `datetime64[D/W/M/Y]`, always fill by using `marshal`.
+                // `datetime.date` objects and date strings, always fill by using `marshal`.
                 fill_date_iter(col, name, np_dtype, type, cidx, is_update);
             } break;
             case DTYPE_BOOL: {
@@ -352,19 +339,229 @@ namespace numpy {
         }
     }
 
-    // `array.dtype=datetime64[ns/us/ms/s]`
+    t_fill_status
+    NumpyLoader::fill_datetime64(const py::array& array, std::shared_ptr<t_column> col, t_dtype type, bool is_update) {
+        PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+
+        // i.e. `("ns", 1)`, or `("ms", 10)` for `datetime64[10ms]`
+        py::tuple unit_info = py::module::import("numpy").attr("datetime_data")(array.dtype());
+        std::string unit = unit_info[0].cast<std::string>();
+        std::int64_t count = unit_info[1].cast<std::int64_t>();
+
+        // Units coarser than a millisecond (or a day) are scaled up by
+        // `ms_per_unit` (or `days_per_unit`), and finer ones divided down by
+        // `units_per_ms` (or `units_per_day`).
+        std::int64_t ms_per_unit = 0;
+        std::int64_t units_per_ms = 0;
+        std::int64_t days_per_unit = 0;
+        std::int64_t units_per_day = 0;
+        bool is_calendar_unit = unit == "Y" || unit == "M";
+
+        if (unit == "W") {
+            days_per_unit = 7;
+        } else if (unit == "D") {
+            days_per_unit = 1;
+        } else if (unit == "h") {
+            ms_per_unit = 3600000;
+            units_per_day = 24;
+        } else if (unit == "m") {
+            ms_per_unit = 60000;
+            units_per_day = 1440;
+        } else if (unit == "s") {
+            ms_per_unit = 1000;
+            units_per_day = 86400;
+        } else if (unit == "ms") {
+            units_per_ms = 1;
+            units_per_day = 86400000;
+        } else if (unit == "us") {
+            units_per_ms = 1000;
+            units_per_day = 86400000000;
+        } else if (unit == "ns") {
+            units_per_ms = 1000000;
+            units_per_day = 86400000000000;
+        } else if (!is_calendar_unit) {
+            return t_fill_status::FILL_FAIL;
+        }
+
+        bool is_day_or_coarser = is_calendar_unit || days_per_unit > 0;
+        if (type == DTYPE_TIME && is_day_or_coarser) {
+            return t_fill_status::FILL_FAIL;
+        }
+
+        const std::int64_t* ptr = (const std::int64_t*) array.data();
+        t_uindex nrows = col->size();
+
+        PerspectiveScopedGILRelease release{std::thread::id()};
+        for (t_uindex i = 0; i < nrows; ++i) {
+            std::int64_t value = ptr[i];
+            if (value == NUMPY_NAT) {
+                fill_null(*col, i, is_update);
+                continue;
+            }
+
+            value *= count;
+
+            if (type == DTYPE_TIME) {
+                std::int64_t ms = ms_per_unit > 0 ? value * ms_per_unit : floor_div(value, units_per_ms);
+                col->set_nth<std::int64_t>(i, ms);
+            } else if (unit == "Y") {
+                col->set_nth<t_date>(i, t_date(static_cast<std::int16_t>(1970 + value), 0, 1));
+            } else if (unit == "M") {
+                std::int64_t years = floor_div(value, 12);
+                col->set_nth<t_date>(i, t_date(static_cast<std::int16_t>(1970 + years), static_cast<std::int8_t>(value - years * 12), 1));
+            } else {
+                std::int64_t days = days_per_unit > 0 ? value * days_per_unit : floor_div(value, units_per_day);
+                col->set_nth<t_date>(i, days_to_date(days));
+            }
+        }
+
+        return t_fill_status::FILL_SUCCESS;
+    }
+
+    template <typename SRC_T, typename DST_T>
+    static void
+    convert_numeric(const SRC_T* src, std::shared_ptr<t_column> col, t_uindex nrows) {
+        DST_T* dst = col->get_nth<DST_T>(0);
+        for (t_uindex i = 0; i < nrows; ++i) {
+            SRC_T value = src[i];
+
+            // `nan` is masked out by the validity map
+            if (std::is_floating_point<SRC_T>::value && std::isnan(static_cast<double>(value))) {
+                dst[i] = 0;
+            } else {
+                dst[i] = static_cast<DST_T>(value);
+            }
+        }
+    }
+
+    /**
+     * Whether every value of `src` can be cast to the integer type `DST_T`
+     * without overflow - casting an out of range or infinite float is
+     * undefined. `nan` is skipped, as it is masked out by the validity map.
+     */
+    template <typename SRC_T, typename DST_T>
+    static bool
+    fits_integer(const SRC_T* src, t_uindex nrows) {
+        if (std::is_integral<SRC_T>::value && sizeof(SRC_T) <= sizeof(DST_T)) {
+            return true;
+        }
+
+        // [-2^(n-1), 2^(n-1)), which are exact as doubles.
+        const double lo = static_cast<double>(std::numeric_limits<DST_T>::min());
+        const double hi = -lo;
+        for (t_uindex i = 0; i < nrows; ++i) {
+            double value = static_cast<double>(src[i]);
+            if (std::isnan(value)) {
+                continue;
+            }
+
+            if (!(value >= lo && value < hi)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename DST_T>
+    static bool
+    fits_integer(const void* ptr, t_dtype np_dtype, t_uindex nrows) {
+        switch (np_dtype) {
+            case DTYPE_INT32: {
+                return fits_integer<std::int32_t, DST_T>((const std::int32_t*) ptr, nrows);
+            }
+            case DTYPE_INT64: {
+                return fits_integer<std::int64_t, DST_T>((const std::int64_t*) ptr, nrows);
+            }
+            case DTYPE_FLOAT32: {
+                return fits_integer<float, DST_T>((const float*) ptr, nrows);
+            }
+            case DTYPE_FLOAT64: {
+                return fits_integer<double, DST_T>((const double*) ptr, nrows);
+            }
+            default: {
+                return true;
+            }
+        }
+    }
+
+    template <typename SRC_T>
+    static void
+    convert_numeric_to(const SRC_T* src, std::shared_ptr<t_column> col, t_dtype type, t_uindex nrows) {
+        switch (type) {
+            case DTYPE_INT32: {
+                convert_numeric<SRC_T, std::int32_t>(src, col, nrows);
+            } break;
+            case DTYPE_INT64: {
+                convert_numeric<SRC_T, std::int64_t>(src, col, nrows);
+            } break;
+            case DTYPE_FLOAT64: {
+                convert_numeric<SRC_T, double>(src, col, nrows);
+            } break;
+            default: {
+                PSP_COMPLAIN_AND_ABORT("Cannot convert numpy array into column of type `" + get_dtype_descr(type) + "`.");
+            }
+        }
+    }
+
     void
-    NumpyLoader::fill_datetime_iter(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column> col, 
-        const std::string& name, t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update) {
+    NumpyLoader::fill_numeric_convert(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column>& col, const std::string& name, t_dtype np_dtype, t_dtype type, bool is_update) {
         PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
         t_uindex nrows = col->size();
+        const void* ptr = array.data();
+        bool promoted = false;
+        std::string promoted_from;
 
-        // read the array as a double array because of `numpy.nat`
-        double* ptr = (double*) array.data();
+        if (nrows == 0) {
+            return;
+        }
 
-        for (auto i = 0; i < nrows; ++i) {
-            std::int64_t item = ptr[i]; // Perspective stores datetimes using int64
-            col->set_nth(i, item);
+        {
+            PerspectiveScopedGILRelease release{std::thread::id()};
+
+            bool fits = true;
+            switch (type) {
+                case DTYPE_INT32: {
+                    fits = fits_integer<std::int32_t>(ptr, np_dtype, nrows);
+                } break;
+                case DTYPE_INT64: {
+                    fits = fits_integer<std::int64_t>(ptr, np_dtype, nrows);
+                } break;
+                default: break;
+            }
+
+            // The first fill promotes the column to float, but an existing
+            // column's type is fixed, so an update must fit it.
+            if (!fits && is_update) {
+                PSP_COMPLAIN_AND_ABORT("Cannot update column `" + name + "` of type `"
+                    + get_dtype_descr(type) + "` with values outside of its range.");
+            } else if (!fits) {
+                promoted_from = get_dtype_descr(type);
+                col = promote_column(tbl, name, DTYPE_FLOAT64, 0, false);
+                type = DTYPE_FLOAT64;
+                promoted = true;
+            }
+
+            switch (np_dtype) {
+                case DTYPE_INT32: {
+                    convert_numeric_to((const std::int32_t*) ptr, col, type, nrows);
+                } break;
+                case DTYPE_INT64: {
+                    convert_numeric_to((const std::int64_t*) ptr, col, type, nrows);
+                } break;
+                case DTYPE_FLOAT32: {
+                    convert_numeric_to((const float*) ptr, col, type, nrows);
+                } break;
+                case DTYPE_FLOAT64: {
+                    convert_numeric_to((const double*) ptr, col, type, nrows);
+                } break;
+                default: {
+                    PSP_COMPLAIN_AND_ABORT("Cannot convert numpy array of type `" + get_dtype_descr(np_dtype) + "`.");
+                }
+            }
+        }
+
+        if (promoted) {
+            binding::WARN("Promoting column `%s` to float from %s", name, promoted_from);
         }
     }
 
@@ -377,11 +574,7 @@ namespace numpy {
             t_val item = m_accessor.attr("marshal")(cidx, i, type);
 
             if (item.is_none()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -473,11 +666,7 @@ namespace numpy {
         // Iterate through the C++ array and try to cast. Array is guaranteed to be of the correct dtype and consistent in its values.
         for (auto i = 0; i < nrows; ++i) {
             if (isnan(((double*) ptr)[i]) || npy_isnan(((double*) ptr)[i])) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
+                fill_null(*col, i, is_update);
                 continue;
             }
 
@@ -577,11 +766,7 @@ namespace numpy {
         if (mask_size > 0) {
             for (auto i = 0; i < mask_size; ++i) {
                 std::uint64_t idx = mask_ptr[i];
-                if (is_update) {
-                    col->unset(idx);
-                } else {
-                    col->clear(idx);
-                }
+                fill_null(*col, idx, is_update);
             }
         }
     }
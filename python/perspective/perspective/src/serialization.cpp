@@ -13,6 +13,8 @@
 #include <perspective/python/serialization.h>
 #include <perspective/python/base.h>
 #include <perspective/python/utils.h>
+#include <ctime>
+#include <unordered_map>
 
 namespace perspective {
 namespace binding {
@@ -25,7 +27,7 @@ template <typename CTX_T>
 std::shared_ptr<t_data_slice<CTX_T>>
 get_data_slice(std::shared_ptr<View<CTX_T>> view, std::uint32_t start_row,
     std::uint32_t end_row, std::uint32_t start_col, std::uint32_t end_col) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
+    PerspectiveScopedGILRelease acquire(*view->get_pool());
     auto data_slice = view->get_data(start_row, end_row, start_col, end_col);
     return data_slice;
 }
@@ -119,6 +121,296 @@ get_pkeys_from_data_slice_ctx2(std::shared_ptr<t_data_slice<t_ctx2>> data_slice,
     return get_pkeys_from_data_slice<t_ctx2>(data_slice, ridx, cidx);
 }
 
+/******************************************************************************
+ *
+ * Columnar numpy serialization
+ */
+
+namespace {
+
+enum t_numpy_kind {
+    NUMPY_KIND_NONE,
+    NUMPY_KIND_INT,
+    NUMPY_KIND_FLOAT,
+    NUMPY_KIND_BOOL,
+    NUMPY_KIND_DATETIME,
+    NUMPY_KIND_DATE,
+    NUMPY_KIND_STRING,
+    NUMPY_KIND_OBJECT
+};
+
+t_numpy_kind
+get_numpy_kind(t_dtype dtype) {
+    switch (dtype) {
+        case DTYPE_INT8:
+        case DTYPE_INT16:
+        case DTYPE_INT32:
+        case DTYPE_INT64:
+        case DTYPE_UINT8:
+        case DTYPE_UINT16:
+        case DTYPE_UINT32:
+        case DTYPE_UINT64: return NUMPY_KIND_INT;
+        case DTYPE_FLOAT32:
+        case DTYPE_FLOAT64: return NUMPY_KIND_FLOAT;
+        case DTYPE_BOOL: return NUMPY_KIND_BOOL;
+        case DTYPE_TIME: return NUMPY_KIND_DATETIME;
+        case DTYPE_DATE: return NUMPY_KIND_DATE;
+        case DTYPE_STR: return NUMPY_KIND_STRING;
+        default: return NUMPY_KIND_OBJECT;
+    }
+}
+
+inline bool
+is_null_scalar(const t_tscalar& scalar) {
+    return !scalar.is_valid() || scalar.get_dtype() == DTYPE_NONE;
+}
+
+std::int64_t
+floor_div(std::int64_t a, std::int64_t b) {
+    std::int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// Days since epoch of a proleptic Gregorian date, `month` in [1, 12].
+std::int64_t
+days_from_civil(std::int64_t year, std::int64_t month, std::int64_t day) {
+    year -= month <= 2;
+    std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    std::int64_t yoe = year - era * 400;
+    std::int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    std::int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/**
+ * Shift milliseconds since epoch into naive local time, which matches the
+ * `datetime.datetime` objects `scalar_to_py` creates.
+ */
+std::int64_t
+to_local_ms(std::int64_t ms) {
+    std::int64_t secs = floor_div(ms, 1000);
+    std::time_t t = static_cast<std::time_t>(secs);
+    std::tm tm;
+#ifdef WIN32
+    localtime_s(&tm, &t);
+#else
+    localtime_r(&t, &tm);
+#endif
+    std::int64_t days = days_from_civil(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
+    std::int64_t local_secs = ((days * 24 + tm.tm_hour) * 60 + tm.tm_min) * 60 + tm.tm_sec;
+    return local_secs * 1000 + (ms - secs * 1000);
+}
+
+/**
+ * `to_local_ms` for a column of values, which only calls `localtime` once
+ * per UTC day converted rather than once per value. A day's UTC offset is
+ * reused if it is the same at both ends of the day, and values in a day
+ * with a DST transition are converted one at a time.
+ */
+class t_local_ms_converter {
+public:
+    t_local_ms_converter()
+        : m_day(std::numeric_limits<std::int64_t>::min())
+        , m_offset(0)
+        , m_constant(false) {}
+
+    std::int64_t
+    convert(std::int64_t ms) {
+        const std::int64_t ms_per_day = 86400000;
+        std::int64_t day = floor_div(ms, ms_per_day);
+        if (day != m_day) {
+            std::int64_t start = day * ms_per_day;
+            std::int64_t end = start + ms_per_day - 1000;
+            m_day = day;
+            m_offset = to_local_ms(start) - start;
+            m_constant = to_local_ms(end) - end == m_offset;
+        }
+
+        return m_constant ? ms + m_offset : to_local_ms(ms);
+    }
+
+private:
+    std::int64_t m_day;
+    std::int64_t m_offset;
+    bool m_constant;
+};
+
+/**
+ * Fill an `object` array from a vector of scalars. Strings are read from
+ * the vocab, so each distinct string is only converted once.
+ */
+py::array
+to_object_array(const std::vector<t_tscalar>& scalars, bool is_string) {
+    py::array rval(py::dtype("O"), scalars.size());
+    PyObject** data = static_cast<PyObject**>(rval.mutable_data());
+    std::unordered_map<const char*, py::object> interned;
+
+    for (t_uindex i = 0; i < scalars.size(); ++i) {
+        const t_tscalar& scalar = scalars[i];
+        py::object value;
+
+        if (is_null_scalar(scalar)) {
+            value = py::none();
+        } else if (is_string && !scalar.is_inplace()) {
+            const char* ptr = scalar.get_char_ptr();
+            auto it = interned.find(ptr);
+            if (it == interned.end()) {
+                it = interned.emplace(ptr, py::str(ptr)).first;
+            }
+            value = it->second;
+        } else {
+            value = scalar_to_py(scalar);
+        }
+
+        PyObject* prev = data[i];
+        data[i] = value.release().ptr();
+        Py_XDECREF(prev);
+    }
+
+    return rval;
+}
+
+} // end anonymous namespace
+
+template <typename CTX_T>
+py::tuple
+get_numpy_from_data_slice(std::shared_ptr<t_data_slice<CTX_T>> data_slice,
+    t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth) {
+    std::vector<t_tscalar> scalars;
+    scalars.reserve(end_row > start_row ? end_row - start_row : 0);
+
+    t_numpy_kind kind = NUMPY_KIND_NONE;
+    bool has_null = false;
+
+    for (t_uindex ridx = start_row; ridx < end_row; ++ridx) {
+        if (leaf_depth > 0 && data_slice->get_row_path(ridx).size() < leaf_depth) {
+            continue;
+        }
+
+        t_tscalar scalar = data_slice->get(ridx, cidx);
+        scalars.push_back(scalar);
+
+        if (is_null_scalar(scalar)) {
+            has_null = true;
+            continue;
+        }
+
+        // Columns whose values disagree on type, i.e. mixed aggregates,
+        // fall back to `object`.
+        t_numpy_kind scalar_kind = get_numpy_kind(scalar.get_dtype());
+        if (kind == NUMPY_KIND_NONE) {
+            kind = scalar_kind;
+        } else if (kind != scalar_kind) {
+            kind = NUMPY_KIND_OBJECT;
+        }
+    }
+
+    t_uindex nrows = scalars.size();
+    py::object mask = py::none();
+
+    switch (kind) {
+        case NUMPY_KIND_INT:
+        case NUMPY_KIND_BOOL: {
+            py::array values(py::dtype(kind == NUMPY_KIND_INT ? "int64" : "bool"), nrows);
+            py::array_t<bool> null_mask(has_null ? nrows : 0);
+            void* ptr = values.mutable_data();
+            bool* mask_ptr = has_null ? null_mask.mutable_data() : nullptr;
+
+            {
+                PerspectiveScopedGILRelease release{std::thread::id()};
+                for (t_uindex i = 0; i < nrows; ++i) {
+                    const t_tscalar& scalar = scalars[i];
+                    bool is_null = is_null_scalar(scalar);
+                    if (kind == NUMPY_KIND_INT) {
+                        static_cast<std::int64_t*>(ptr)[i] = is_null ? 0 : scalar.to_int64();
+                    } else {
+                        static_cast<bool*>(ptr)[i] = is_null ? false : static_cast<bool>(scalar);
+                    }
+                    if (mask_ptr != nullptr) {
+                        mask_ptr[i] = is_null;
+                    }
+                }
+            }
+
+            if (has_null) {
+                mask = null_mask;
+            }
+
+            return py::make_tuple(values, mask);
+        }
+        case NUMPY_KIND_FLOAT: {
+            py::array_t<double> values(nrows);
+            double* ptr = values.mutable_data();
+
+            {
+                PerspectiveScopedGILRelease release{std::thread::id()};
+                for (t_uindex i = 0; i < nrows; ++i) {
+                    const t_tscalar& scalar = scalars[i];
+                    ptr[i] = is_null_scalar(scalar) ? std::numeric_limits<double>::quiet_NaN() : scalar.to_double();
+                }
+            }
+
+            return py::make_tuple(values, mask);
+        }
+        case NUMPY_KIND_DATETIME:
+        case NUMPY_KIND_DATE: {
+            // numpy represents `NaT` as the smallest int64.
+            const std::int64_t nat = std::numeric_limits<std::int64_t>::min();
+            py::array values(py::dtype("datetime64[ms]"), nrows);
+            std::int64_t* ptr = static_cast<std::int64_t*>(values.mutable_data());
+
+            {
+                PerspectiveScopedGILRelease release{std::thread::id()};
+                t_local_ms_converter local;
+                for (t_uindex i = 0; i < nrows; ++i) {
+                    const t_tscalar& scalar = scalars[i];
+                    if (is_null_scalar(scalar)) {
+                        ptr[i] = nat;
+                    } else if (kind == NUMPY_KIND_DATETIME) {
+                        ptr[i] = local.convert(scalar.to_int64());
+                    } else {
+                        // `t_date` months are 0-based
+                        t_date date = scalar.get<t_date>();
+                        ptr[i] = days_from_civil(date.year(), date.month() + 1, date.day()) * 86400000;
+                    }
+                }
+            }
+
+            return py::make_tuple(values, mask);
+        }
+        case NUMPY_KIND_STRING: {
+            return py::make_tuple(to_object_array(scalars, true), mask);
+        }
+        default: {
+            return py::make_tuple(to_object_array(scalars, false), mask);
+        }
+    }
+}
+
+py::tuple
+get_numpy_from_data_slice_unit(std::shared_ptr<t_data_slice<t_ctxunit>> data_slice,
+    t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth) {
+    return get_numpy_from_data_slice<t_ctxunit>(data_slice, start_row, end_row, cidx, leaf_depth);
+}
+
+py::tuple
+get_numpy_from_data_slice_ctx0(std::shared_ptr<t_data_slice<t_ctx0>> data_slice,
+    t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth) {
+    return get_numpy_from_data_slice<t_ctx0>(data_slice, start_row, end_row, cidx, leaf_depth);
+}
+
+py::tuple
+get_numpy_from_data_slice_ctx1(std::shared_ptr<t_data_slice<t_ctx1>> data_slice,
+    t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth) {
+    return get_numpy_from_data_slice<t_ctx1>(data_slice, start_row, end_row, cidx, leaf_depth);
+}
+
+py::tuple
+get_numpy_from_data_slice_ctx2(std::shared_ptr<t_data_slice<t_ctx2>> data_slice,
+    t_uindex start_row, t_uindex end_row, t_uindex cidx, t_uindex leaf_depth) {
+    return get_numpy_from_data_slice<t_ctx2>(data_slice, start_row, end_row, cidx, leaf_depth);
+}
+
 } // end namespace binding
 } // end namespace perspective
 
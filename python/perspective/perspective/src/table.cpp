@@ -35,6 +35,16 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
     std::shared_ptr<t_gnode> gnode;
     std::uint32_t offset;
     void* ptr = nullptr;
+    std::string index_name = index;
+    py::bytes arrow_bytes;
+
+    // Whether to read the arrow one record batch at a time, processing each
+    // batch before reading the next.
+    bool is_arrow_stream = false;
+
+    // Whether to send a CSV update to the input port one record batch at a
+    // time, after it has been parsed in parallel.
+    bool is_csv_stream = false;
 
     // If the Table has already been created, use it
     if (table_initialized) {
@@ -58,14 +68,73 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
     // Determine metadata
     bool is_delete = op == OP_DELETE;
     if (is_arrow && !is_delete) {
-        py::bytes bytes = accessor.cast<py::bytes>();
-        std::int32_t size = bytes.attr("__len__")().cast<std::int32_t>();
-        ptr = malloc(size);
-        std::memcpy(ptr, bytes.cast<std::string>().c_str(), size);
+        // A `str` is CSV text and a path-like object is an arrow or CSV
+        // file on disk, all of which are read through arrow. A
+        // `pyarrow.RecordBatchReader`, e.g. decoding a Parquet, is imported
+        // through the arrow C stream interface.
+        bool is_path = py::hasattr(accessor, "__fspath__");
+        bool is_csv = is_path || py::isinstance<py::str>(accessor);
+        bool is_c_stream = py::hasattr(accessor, "_export_to_c");
+        std::string csv;
+        std::unordered_map<std::string, std::shared_ptr<arrow::DataType>> csv_types;
+        std::int64_t size = 0;
+        struct ArrowArrayStream c_stream;
+
+        if (is_c_stream) {
+            accessor.attr("_export_to_c")(reinterpret_cast<std::uintptr_t>(&c_stream));
+            is_arrow_stream = true;
+        } else if (is_csv) {
+            csv = is_path
+                ? accessor.attr("__fspath__")().cast<std::string>()
+                : accessor.cast<std::string>();
+            if (is_path && ArrowLoader::is_arrow_file(csv)) {
+                is_csv = false;
+                is_arrow_stream = true;
+            } else if (table_initialized && is_update) {
+                // The update's types are known, so it does not have to be
+                // read in full to infer them.
+                csv_types = get_csv_column_types(
+                    gnode->get_output_schema().drop({"psp_okey"}));
+                is_csv_stream = true;
+            }
+        } else {
+            // Read the arrow directly out of the `bytes` object, which the
+            // caller keeps alive, instead of copying it.
+            arrow_bytes = accessor.cast<py::bytes>();
+            ptr = PyBytes_AsString(arrow_bytes.ptr());
+            size = PyBytes_Size(arrow_bytes.ptr());
+
+            // The first load has no callbacks to notify, so its record
+            // batches can be processed as they are read.
+            is_arrow_stream = !table_initialized;
+        }
+
         {
             PerspectiveScopedGILRelease acquire(pool->get_event_loop_thread_id());
-        
-            arrow_loader.initialize((uintptr_t)ptr, size);
+
+            if (is_c_stream) {
+                arrow_loader.init_batches_c_stream(&c_stream);
+            } else if (is_arrow_stream && is_path) {
+                arrow_loader.init_batches_file(csv);
+            } else if (is_arrow_stream) {
+                arrow_loader.init_batches((uintptr_t)ptr, size);
+            } else if (is_csv_stream && is_path) {
+                arrow_loader.init_csv_file_batches(csv, csv_types);
+            } else if (is_csv_stream) {
+                arrow_loader.init_csv_batches(csv, csv_types);
+            } else if (is_path) {
+                arrow_loader.init_csv_file(csv, is_update, csv_types);
+            } else if (is_csv) {
+                arrow_loader.init_csv(csv, is_update, csv_types);
+            } else {
+                arrow_loader.initialize((uintptr_t)ptr, size);
+            }
+        }
+
+        {
+            // Reading and promoting the gnode's schema must not race with
+            // another thread processing the same table.
+            PerspectiveScopedGILRelease acquire(*pool);
 
             // Always use the `Table` column names and data types on update.
             if (table_initialized && is_update) {
@@ -179,11 +248,66 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
     t_data_table data_table(output_schema);
     data_table.init();
     std::uint32_t row_count;
+
+    if (is_arrow_stream) {
+        // Only one record batch is resident at a time, and its rows reach
+        // the table before the next batch is read. After the last batch the
+        // loader holds an empty table, which still creates the gnode if the
+        // arrow had no batches at all. An update is appended to the input
+        // port batch by batch and processed once, so its callbacks fire once.
+        bool did_send = false;
+        PerspectiveScopedGILRelease acquire(*pool);
+        while (true) {
+            t_data_table batch_table(output_schema);
+            batch_table.init();
+            bool has_batch = arrow_loader.next_batch();
+            if (!has_batch && did_send) {
+                break;
+            }
+
+            row_count = arrow_loader.row_count();
+            batch_table.extend(row_count);
+            arrow_loader.fill_table(batch_table, input_schema, index_name, offset, limit, is_update);
+
+            tbl->init(batch_table, row_count, op, port_id);
+            offset = tbl->get_offset();
+            did_send = true;
+            if (!table_initialized) {
+                pool->_process();
+            }
+        }
+
+        if (table_initialized) {
+            pool->_process();
+        }
+
+        return tbl;
+    }
+
+    if (is_csv_stream) {
+        // Only one batch is filled into a `t_data_table` at a time. The input
+        // port appends each batch, and the engine lock is held until the last
+        // is sent, so the processing thread never sees part of the update.
+        PerspectiveScopedGILRelease acquire(*pool);
+        while (arrow_loader.next_batch()) {
+            t_data_table batch_table(output_schema);
+            batch_table.init();
+            row_count = arrow_loader.row_count();
+            batch_table.extend(row_count);
+            arrow_loader.fill_table(batch_table, input_schema, index_name, offset, limit, is_update);
+
+            tbl->init(batch_table, row_count, op, port_id);
+            offset = tbl->get_offset();
+        }
+
+        return tbl;
+    }
+
     if (is_arrow) {
         PerspectiveScopedGILRelease acquire(pool->get_event_loop_thread_id());
         row_count = arrow_loader.row_count();
         data_table.extend(arrow_loader.row_count());
-        arrow_loader.fill_table(data_table, input_schema, index, offset, limit, is_update);
+        arrow_loader.fill_table(data_table, input_schema, index_name, offset, limit, is_update);
     } else if (is_numpy) {
         row_count = numpy_loader.row_count();
         data_table.extend(row_count);
@@ -194,17 +318,32 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
         _fill_data(data_table, accessor, input_schema, index, offset, limit, is_update);
     }
 
-    if (is_arrow) {
-        free(ptr);
-    }
-
     // calculate offset, limit, and set the gnode
-    tbl->init(data_table, row_count, op, port_id);    
+    {
+        PerspectiveScopedGILRelease acquire(*pool);
+        tbl->init(data_table, row_count, op, port_id);
+    }
 
     //pool->_process();
     return tbl;
 }
 
+void
+process_py(t_pool& pool) {
+    PerspectiveScopedGILRelease acquire(pool);
+    pool._process();
+}
+
+void
+stop_processing_thread_py(t_pool& pool) {
+    // Must not hold the engine lock, which the thread needs to finish. May be
+    // called by an update callback on the processing thread itself.
+    PerspectiveScopedGILRelease acquire(pool.on_processing_thread()
+        ? std::thread::id()
+        : pool.get_event_loop_thread_id());
+    pool.stop_processing_thread();
+}
+
 } //namespace binding
 } //namespace perspective
 
@@ -252,6 +252,10 @@ make_view_config(std::shared_ptr<t_schema> schema, t_val date_parser, t_val conf
         view_config->set_column_pivot_depth(config.attr("column_pivot_depth").cast<std::int32_t>());
     }
 
+    if (! config.attr("limit").is_none()) {
+        view_config->set_limit(config.attr("limit").cast<std::int32_t>());
+    }
+
     return view_config;
 }
 
@@ -267,7 +271,7 @@ make_view(std::shared_ptr<Table> table, const std::string& name, const std::stri
     std::shared_ptr<t_schema> schema = std::make_shared<t_schema>(table->get_schema());
     std::shared_ptr<t_view_config> config = make_view_config<t_val>(schema, date_parser, view_config);
     {
-        PerspectiveScopedGILRelease acquire(table->get_pool()->get_event_loop_thread_id());
+        PerspectiveScopedGILRelease acquire(*table->get_pool());
         auto ctx = make_context<CTX_T>(table, schema, config, name);
         auto view_ptr = std::make_shared<View<CTX_T>>(table, ctx, name, separator, config);
         return view_ptr;
@@ -311,9 +315,13 @@ to_arrow_unit(
     std::int32_t start_col,
     std::int32_t end_col
 ) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<std::string> str = 
-        view->to_arrow(start_row, end_row, start_col, end_col);
+    std::shared_ptr<std::string> str;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        str = view->to_arrow(start_row, end_row, start_col, end_col);
+    }
+
+    // The `bytes` object must be created with the GIL held.
     return py::bytes(*str);
 }
 
@@ -325,9 +333,12 @@ to_arrow_zero(
     std::int32_t start_col,
     std::int32_t end_col
 ) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<std::string> str = 
-        view->to_arrow(start_row, end_row, start_col, end_col);
+    std::shared_ptr<std::string> str;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        str = view->to_arrow(start_row, end_row, start_col, end_col);
+    }
+
     return py::bytes(*str);
 }
 
@@ -339,9 +350,12 @@ to_arrow_one(
     std::int32_t start_col, 
     std::int32_t end_col
 ) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<std::string> str = 
-        view->to_arrow(start_row, end_row, start_col, end_col);
+    std::shared_ptr<std::string> str;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        str = view->to_arrow(start_row, end_row, start_col, end_col);
+    }
+
     return py::bytes(*str);
 }
 
@@ -353,9 +367,12 @@ to_arrow_two(
     std::int32_t start_col, 
     std::int32_t end_col
 ) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<std::string> str = 
-        view->to_arrow(start_row, end_row, start_col, end_col);
+    std::shared_ptr<std::string> str;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        str = view->to_arrow(start_row, end_row, start_col, end_col);
+    }
+
     return py::bytes(*str);
 }
 
@@ -366,37 +383,125 @@ to_arrow_two(
 
 py::bytes
 get_row_delta_unit(std::shared_ptr<View<t_ctxunit>> view) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctxunit>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        std::shared_ptr<t_data_slice<t_ctxunit>> slice = view->get_row_delta();
+        arrow = view->data_slice_to_arrow(slice);
+    }
+
     return py::bytes(*arrow);
 }
 
+std::vector<t_val>
+get_row_delta_pkeys_unit(std::shared_ptr<View<t_ctxunit>> view) {
+    std::vector<t_tscalar> pkeys;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        pkeys = view->get_context()->get_row_delta_pkeys();
+    }
+
+    std::vector<t_val> rval(pkeys.size());
+    for (t_uindex idx = 0; idx < pkeys.size(); ++idx) {
+        rval[idx] = scalar_to_py(pkeys[idx]);
+    }
+
+    return rval;
+}
+
 py::bytes
 get_row_delta_zero(std::shared_ptr<View<t_ctx0>> view) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctx0>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        std::shared_ptr<t_data_slice<t_ctx0>> slice = view->get_row_delta();
+        arrow = view->data_slice_to_arrow(slice);
+    }
+
     return py::bytes(*arrow);
 }
 
 py::bytes
 get_row_delta_one(std::shared_ptr<View<t_ctx1>> view) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctx1>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        std::shared_ptr<t_data_slice<t_ctx1>> slice = view->get_row_delta();
+        arrow = view->data_slice_to_arrow(slice);
+    }
+
     return py::bytes(*arrow);
 }
 
 py::bytes
 get_row_delta_two(
     std::shared_ptr<View<t_ctx2>> view) {
-    PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctx2>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow;
+    {
+        PerspectiveScopedGILRelease acquire(*view->get_pool());
+        std::shared_ptr<t_data_slice<t_ctx2>> slice = view->get_row_delta();
+        arrow = view->data_slice_to_arrow(slice);
+    }
+
     return py::bytes(*arrow);
 }
 
+/******************************************************************************
+ *
+ * expand/collapse
+ */
+
+template <typename CTX_T>
+t_index
+expand(std::shared_ptr<View<CTX_T>> view, std::int32_t ridx, std::int32_t row_pivot_length) {
+    PerspectiveScopedGILRelease acquire(*view->get_pool());
+    return view->expand(ridx, row_pivot_length);
+}
+
+template <typename CTX_T>
+t_index
+collapse(std::shared_ptr<View<CTX_T>> view, std::int32_t ridx) {
+    PerspectiveScopedGILRelease acquire(*view->get_pool());
+    return view->collapse(ridx);
+}
+
+template <typename CTX_T>
+void
+set_depth(std::shared_ptr<View<CTX_T>> view, std::int32_t depth, std::int32_t row_pivot_length) {
+    PerspectiveScopedGILRelease acquire(*view->get_pool());
+    view->set_depth(depth, row_pivot_length);
+}
+
+t_index
+expand_one(std::shared_ptr<View<t_ctx1>> view, std::int32_t ridx, std::int32_t row_pivot_length) {
+    return expand<t_ctx1>(view, ridx, row_pivot_length);
+}
+
+t_index
+expand_two(std::shared_ptr<View<t_ctx2>> view, std::int32_t ridx, std::int32_t row_pivot_length) {
+    return expand<t_ctx2>(view, ridx, row_pivot_length);
+}
+
+t_index
+collapse_one(std::shared_ptr<View<t_ctx1>> view, std::int32_t ridx) {
+    return collapse<t_ctx1>(view, ridx);
+}
+
+t_index
+collapse_two(std::shared_ptr<View<t_ctx2>> view, std::int32_t ridx) {
+    return collapse<t_ctx2>(view, ridx);
+}
+
+void
+set_depth_one(std::shared_ptr<View<t_ctx1>> view, std::int32_t depth, std::int32_t row_pivot_length) {
+    set_depth<t_ctx1>(view, depth, row_pivot_length);
+}
+
+void
+set_depth_two(std::shared_ptr<View<t_ctx2>> view, std::int32_t depth, std::int32_t row_pivot_length) {
+    set_depth<t_ctx2>(view, depth, row_pivot_length);
+}
+
 } //namespace binding
 } //namespace perspective
 
@@ -22,6 +22,10 @@ from .libbinding import (
     get_pkeys_from_data_slice_zero,
     get_pkeys_from_data_slice_one,
     get_pkeys_from_data_slice_two,
+    get_numpy_from_data_slice_unit,
+    get_numpy_from_data_slice_zero,
+    get_numpy_from_data_slice_one,
+    get_numpy_from_data_slice_two,
     scalar_to_py,
 )
 
@@ -40,9 +44,12 @@ def to_format(options, view, output_format):
     view._table._state_manager.call_process(view._table._table.get_id())
     options, column_names, data_slice = _to_format_helper(view, options)
 
+    if output_format == "numpy":
+        return _to_numpy(options, view, column_names, data_slice)
+
     if output_format == "records":
         data = []
-    elif output_format in ("dict", "numpy"):
+    elif output_format == "dict":
         data = {}
         if options["index"]:
             data["__INDEX__"] = []
@@ -80,15 +87,14 @@ def to_format(options, view, output_format):
                         data[-1]["__ROW_PATH__"] = paths
                         if options["id"]:
                             data[-1]["__ID__"] = paths
-                    elif output_format in ("dict", "numpy"):
+                    elif output_format == "dict":
                         if "__ROW_PATH__" not in data:
                             data["__ROW_PATH__"] = []
                         data["__ROW_PATH__"].append(paths)
                         if options["id"]:
                             data["__ID__"].append(paths)
             else:
-                if output_format in ("dict", "numpy") and (name not in data):
-                    # TODO: push into C++ for numpy
+                if output_format == "dict" and (name not in data):
                     data[name] = []
                 if view._is_unit_context:
                     value = get_from_data_slice_unit(data_slice, ridx, cidx)
@@ -118,7 +124,7 @@ def to_format(options, view, output_format):
                 data[-1]["__INDEX__"] = []
                 for pkey in pkeys:
                     data[-1]["__INDEX__"].append(pkey)
-            elif output_format in ("dict", "numpy"):
+            elif output_format == "dict":
                 # ensure that `__INDEX__` has the same number of rows as
                 # returned dataset
                 if len(pkeys) == 0:
@@ -136,21 +142,118 @@ def to_format(options, view, output_format):
                 data[-1]["__ID__"] = []
                 for pkey in pkeys:
                     data[-1]["__ID__"].append(pkey)
-            elif output_format in ("dict", "numpy"):
+            elif output_format == "dict":
                 if len(pkeys) == 0:
                     data["__ID__"].append([])
                 for pkey in pkeys:
                     data["__ID__"].append([pkey])
 
-    if output_format in ("dict", "numpy") and (
+    if output_format == "dict" and (
         not options["has_row_path"] and ("__ROW_PATH__" in data)
     ):
         del data["__ROW_PATH__"]
 
-    if output_format == "numpy":
-        for k, v in data.items():
-            # TODO push into C++
-            data[k] = np.array(v)
+    return data
+
+
+def _to_numpy(options, view, column_names, data_slice):
+    """Serialize a data slice into a dictionary of numpy arrays.
+
+    Data columns are read out of the slice in C++ as typed arrays - integer
+    and boolean columns with nulls are returned as masked arrays, float
+    and datetime columns use `NaN` and `NaT`, and strings are `object`
+    arrays. Only the row path, index and ID columns are built row by row.
+    """
+    if view._is_unit_context:
+        get_numpy, get_pkeys = (
+            get_numpy_from_data_slice_unit,
+            get_pkeys_from_data_slice_unit,
+        )
+    elif view._sides == 0:
+        get_numpy, get_pkeys = (
+            get_numpy_from_data_slice_zero,
+            get_pkeys_from_data_slice_zero,
+        )
+    elif view._sides == 1:
+        get_numpy, get_pkeys = (
+            get_numpy_from_data_slice_one,
+            get_pkeys_from_data_slice_one,
+        )
+    else:
+        get_numpy, get_pkeys = (
+            get_numpy_from_data_slice_two,
+            get_pkeys_from_data_slice_two,
+        )
+
+    data = {}
+    num_row_pivots = len(view._config.get_row_pivots())
+    leaf_depth = num_row_pivots if options["leaves_only"] else 0
+    has_id = options["id"] and (view._is_unit_context or view._sides == 0)
+
+    if options["index"]:
+        data["__INDEX__"] = []
+
+    if options["id"]:
+        data["__ID__"] = []
+
+    if options["has_row_path"] or options["index"] or has_id:
+        row_paths = []
+        for ridx in range(options["start_row"], options["end_row"]):
+            row_path = data_slice.get_row_path(ridx) if options["has_row_path"] else []
+            if options["leaves_only"] and len(row_path) < num_row_pivots:
+                continue
+
+            if options["has_row_path"]:
+                paths = [
+                    scalar_to_py(path, False, False) for path in reversed(row_path)
+                ]
+                row_paths.append(paths)
+                if options["id"]:
+                    data["__ID__"].append(paths)
+
+            if options["index"]:
+                pkeys = get_pkeys(data_slice, ridx, 0)
+                if len(pkeys) == 0:
+                    data["__INDEX__"].append([])
+                for pkey in pkeys:
+                    data["__INDEX__"].append([pkey])
+
+            if has_id:
+                pkeys = get_pkeys(data_slice, ridx, 0)
+                if len(pkeys) == 0:
+                    data["__ID__"].append([])
+                for pkey in pkeys:
+                    data["__ID__"].append([pkey])
+
+        if options["has_row_path"] and options["start_col"] < options["end_col"]:
+            data["__ROW_PATH__"] = np.array(row_paths)
+
+    for k in ("__INDEX__", "__ID__"):
+        if k in data:
+            data[k] = np.array(data[k])
+
+    num_columns = len(view._config.get_columns())
+    num_hidden = view._num_hidden_cols()
+
+    for cidx in range(options["start_col"], options["end_col"]):
+        if (
+            _mod((cidx - (1 if view._sides > 0 else 0)), (num_columns + num_hidden))
+            >= num_columns
+        ):
+            # don't emit columns used for hidden sort
+            continue
+        elif cidx == options["start_col"] and view._sides > 0:
+            # the row path column
+            continue
+
+        values, mask = get_numpy(
+            data_slice, options["start_row"], options["end_row"], cidx, leaf_depth
+        )
+
+        if mask is not None:
+            values = np.ma.masked_array(values, mask=mask)
+
+        data[column_names[cidx]] = values
 
     return data
 
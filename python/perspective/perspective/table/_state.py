@@ -65,10 +65,12 @@ class _PerspectiveStateManager(object):
         Args:
             table_id (:obj`int`): The unique ID of the Table
         """
-        pool = _PerspectiveStateManager.TO_PROCESS.get(table_id, None)
+        # `_process()` releases the GIL, so remove the table before calling
+        # it - an update from another thread in the meantime queues a new
+        # call instead of being dropped.
+        pool = _PerspectiveStateManager.TO_PROCESS.pop(table_id, None)
         if pool is not None:
             pool._process()
-            self.remove_process(table_id)
 
     def remove_process(self, table_id):
         """Remove a pool from the execution cache, indicating that it should no
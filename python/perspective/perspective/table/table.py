@@ -7,10 +7,11 @@
 #
 
 from six import string_types
-from datetime import date, datetime
+from datetime import date, datetime, timedelta
 from .view import View
 from ._accessor import _PerspectiveAccessor
 from ._callback_cache import _PerspectiveCallBackCache
+from ..core.data.parquet import is_parquet, parquet_to_reader
 from ..core.exception import PerspectiveError
 from ._date_validator import _PerspectiveDateValidator
 from ._state import _PerspectiveStateManager
@@ -27,8 +28,19 @@ from .libbinding import (
 )
 
 
+def _is_arrow_or_csv(data):
+    """Returns whether `data` is loaded through the arrow reader: an arrow
+    binary, a string of CSV text, or a path-like object pointing to an
+    arrow or CSV file."""
+    return isinstance(data, (bytes, bytearray, string_types)) or hasattr(
+        data, "__fspath__"
+    )
+
+
 class Table(object):
-    def __init__(self, data, limit=None, index=None):
+    def __init__(
+        self, data, limit=None, index=None, expire_column=None, expire_after=None
+    ):
         """Construct a :class:`~perspective.Table` using the provided data or
         schema and optional configuration dictionary.
 
@@ -38,8 +50,14 @@ class Table(object):
         conform to the column names and data types provided in the schema.
 
         Args:
-            data (:obj:`dict`/:obj:`list`/:obj:`pandas.DataFrame`): Data or
-                schema which initializes the :class:`~perspective.Table`.
+            data (:obj:`dict`/:obj:`list`/:obj:`pandas.DataFrame`/:obj:`bytes`/:obj:`str`/:obj:`pathlib.Path`):
+                Data or schema which initializes the
+                :class:`~perspective.Table`. A :obj:`str` is read as CSV
+                text, and a :obj:`pathlib.Path` as an arrow, CSV or Parquet
+                file, which is memory-mapped. Arrow files and streams are
+                loaded one record batch at a time. Parquet binaries and files
+                are decoded one record batch at a time by `pyarrow`, which
+                they require.
 
         Keyword Args:
             index (:obj:`str`): A string column name to use as the
@@ -48,8 +66,24 @@ class Table(object):
                 :class:`~perspective.Table` should have.  Cannot be set at the
                 same time as ``index``. Updates past the limit will begin
                 writing at row 0.
+            expire_column (:obj:`str`): A datetime or integer column by which
+                rows are expired, compared against the current wall-clock time
+                in milliseconds since the epoch - so integer columns must hold
+                epoch milliseconds too. Must be set with ``expire_after``.
+            expire_after (:obj:`int`/:obj:`datetime.timedelta`): Rows whose
+                ``expire_column`` is older than this window (in milliseconds)
+                are removed from the
+                :class:`~perspective.Table` - as soon as they age out if
+                ``start_processing_thread()`` is running, and otherwise on
+                the next update.
         """
-        self._is_arrow = isinstance(data, (bytes, bytearray))
+        # A Parquet is loaded from the record batches `pyarrow` decodes.
+        if is_parquet(data):
+            data = parquet_to_reader(data)
+            self._is_arrow = True
+        else:
+            self._is_arrow = _is_arrow_or_csv(data)
+
         if self._is_arrow:
             _accessor = data
         else:
@@ -75,11 +109,39 @@ class Table(object):
         )
 
         self._gnode_id = self._table.get_gnode().get_id()
+        self._expire_column = None
+        self._expire_after = None
+
+        if expire_column is not None or expire_after is not None:
+            if expire_column is None or expire_after is None:
+                raise PerspectiveError(
+                    "`expire_column` and `expire_after` must be set together."
+                )
+
+            if isinstance(expire_after, timedelta):
+                expire_after = int(expire_after.total_seconds() * 1000)
+
+            if not isinstance(expire_after, int) or expire_after <= 0:
+                raise PerspectiveError(
+                    "`expire_after` must be a positive int or timedelta."
+                )
+
+            self._table.set_expiry(expire_column, expire_after)
+            self._expire_column = expire_column
+            self._expire_after = expire_after
         self._update_callbacks = _PerspectiveCallBackCache()
         self._delete_callbacks = _PerspectiveCallBackCache()
         self._views = []
         self._delete_callback = None
 
+        # Posts `on_update` callbacks from the processing thread, if set.
+        self._update_dispatch = None
+        self._queue_process = None
+
+        # The `PerspectiveReplicaPublisher` replicating this table, which is
+        # told of removes and clears as they are not seen by `on_update`.
+        self._publisher = None
+
         pool = self._table.get_pool()
         pool.set_update_delegate(self)
         pool._process()
@@ -97,6 +159,89 @@ class Table(object):
         """Remove the specified port from the underlying `gnode`."""
         self._table.remove_port()
 
+    def start_processing_thread(self, window=0, loop_callback=None, max_rows=None):
+        """Apply updates on a native thread owned by this
+        :class:`~perspective.Table`, instead of synchronously in `update()`
+        or on an event loop, so that ingest is not bound to the loop's tick
+        rate. Reading from the :class:`~perspective.Table` or its views still
+        applies any pending updates first.
+
+        Keyword Args:
+            window (:obj:`int`/:obj:`datetime.timedelta`): How long the thread
+                waits after an update, in milliseconds, so that updates
+                arriving together are processed as one. Defaults to 0.
+            loop_callback (:obj:`func`): A thread-safe function which
+                schedules a function and its args on an event loop, i.e.
+                `IOLoop.add_callback`. `on_update` callbacks are posted to the
+                loop through it, and otherwise run on the processing thread.
+            max_rows (:obj:`int`): The number of queued rows after which the
+                thread stops waiting out the `window`, or `None` for no limit.
+        """
+        if isinstance(window, timedelta):
+            window = int(window.total_seconds() * 1000)
+
+        if not isinstance(window, int) or window < 0:
+            raise PerspectiveError("`window` must be a non-negative int or timedelta.")
+
+        if max_rows is None:
+            max_rows = 0
+        elif not isinstance(max_rows, int) or max_rows <= 0:
+            raise PerspectiveError("`max_rows` must be a positive int.")
+
+        if loop_callback is not None and not callable(loop_callback):
+            raise PerspectiveError("`loop_callback` must be a function")
+
+        pool = self._table.get_pool()
+        if not pool.has_processing_thread():
+            self._queue_process = self._state_manager.queue_process
+            self._state_manager.queue_process = lambda table_id: None
+
+        self._update_dispatch = loop_callback
+        pool.start_processing_thread(window, max_rows)
+
+    def _set_queue_process(self, queue_process):
+        """Set how `update()` schedules processing, which only takes effect
+        once the processing thread, if running, is stopped.
+        """
+        if self._table.get_pool().has_processing_thread():
+            self._queue_process = queue_process
+        else:
+            self._state_manager.queue_process = queue_process
+
+    def stop_processing_thread(self):
+        """Stop the thread started by `start_processing_thread()`, and
+        return to processing updates in `update()` or on the event loop.
+        """
+        pool = self._table.get_pool()
+        if not pool.has_processing_thread():
+            return
+
+        pool.stop_processing_thread()
+        self._state_manager.queue_process = self._queue_process
+        self._queue_process = None
+        self._update_dispatch = None
+        self._state_manager.call_process(self._table.get_id())
+
+    def update_metrics(self):
+        """Returns counters of the updates applied to this
+        :class:`~perspective.Table`, and how they were batched together.
+
+        Returns:
+            :obj:`dict`: `queued_batches` and `queued_rows`, the updates
+                waiting to be applied, and `num_processed`,
+                `batches_processed`, `rows_processed` and `max_batch_rows`,
+                the totals over every time updates were applied.
+        """
+        metrics = self._table.get_pool().get_metrics()
+        return {
+            "queued_batches": metrics.queued_batches,
+            "queued_rows": metrics.queued_rows,
+            "num_processed": metrics.num_processed,
+            "batches_processed": metrics.batches_processed,
+            "rows_processed": metrics.rows_processed,
+            "max_batch_rows": metrics.max_batch_rows,
+        }
+
     def compute(self):
         """Returns whether the computed column feature is enabled."""
         return True
@@ -119,6 +264,9 @@ class Table(object):
         self._state_manager.remove_process(self._table.get_id())
         self._table.reset_gnode(self._gnode_id)
 
+        if self._publisher is not None:
+            self._publisher._on_clear()
+
     def replace(self, data):
         """Replaces all rows in the :class:`~perspective.Table` with the new
         data that conforms to the :class:`~perspective.Table` schema.
@@ -129,6 +277,10 @@ class Table(object):
         """
         self._state_manager.remove_process(self._table.get_id())
         self._table.reset_gnode(self._gnode_id)
+
+        if self._publisher is not None:
+            self._publisher._on_clear()
+
         self.update(data)
         self._state_manager.call_process(self._table.get_id())
 
@@ -297,8 +449,11 @@ class Table(object):
         append.
 
         Args:
-            data (:obj:`dict`/:obj:`list`/:obj:`pandas.DataFrame`): The data
-                with which to update the :class:`~perspective.Table`.
+            data (:obj:`dict`/:obj:`list`/:obj:`pandas.DataFrame`/:obj:`bytes`/:obj:`str`/:obj:`pathlib.Path`):
+                The data with which to update the
+                :class:`~perspective.Table`, in any format the constructor
+                accepts. Only the :class:`~perspective.Table`'s own columns
+                are decoded from a Parquet.
 
         Examples:
             >>> tbl = Table({"a": [1, 2, 3], "b": ["a", "b", "c"]}, index="a")
@@ -309,7 +464,11 @@ class Table(object):
         if not port_id:
             port_id = 0
 
-        _is_arrow = isinstance(data, (bytes, bytearray))
+        if is_parquet(data):
+            data = parquet_to_reader(data, columns=self.columns())
+            _is_arrow = True
+        else:
+            _is_arrow = _is_arrow_or_csv(data)
 
         if _is_arrow:
             _accessor = data
@@ -381,7 +540,8 @@ class Table(object):
         if self._index is None:
             return
 
-        pkeys = list(map(lambda idx: {self._index: idx}, pkeys))
+        original_pkeys = list(pkeys)
+        pkeys = list(map(lambda idx: {self._index: idx}, original_pkeys))
         types = [self._table.get_schema().get_dtype(self._index)]
         _accessor = _PerspectiveAccessor(pkeys)
         _accessor._names = [self._index]
@@ -400,6 +560,9 @@ class Table(object):
 
         self._state_manager.set_process(t.get_pool(), t.get_id())
 
+        if self._publisher is not None:
+            self._publisher._on_remove(original_pkeys)
+
     def view(
         self,
         columns=None,
@@ -409,6 +572,7 @@ class Table(object):
         sort=None,
         filter=None,
         computed_columns=None,
+        limit=None,
     ):
         """Create a new :class:`~perspective.View` from this
         :class:`~perspective.Table` via the supplied keyword arguments.
@@ -434,6 +598,9 @@ class Table(object):
             filter (:obj:`list` of :obj:`list` of :obj:`str`):  A list of lists,
                 each list containing a column name, a filter comparator, and a
                 value to filter by.
+            limit (:obj:`int`): The maximum number of rows of a sorted view
+                without pivots. Only the first ``limit`` rows in sort order
+                are kept, which is cheaper to maintain than sorting every row.
 
         Returns:
             :class:`~perspective.View`: A new :class:`~perspective.View`
@@ -468,6 +635,8 @@ class Table(object):
             config["filter"] = filter
         if computed_columns is not None:
             config["computed_columns"] = computed_columns
+        if limit is not None:
+            config["limit"] = limit
 
         view = View(self, **config)
         self._views.append(view._name)
@@ -519,6 +688,7 @@ class Table(object):
                 "Cannot delete a Table with active views still linked to it "
                 + "- call delete() on each view, and try again."
             )
+        self.stop_processing_thread()
         self._state_manager.remove_process(self._table.get_id())
         self._table.unregister_gnode(self._gnode_id)
         [cb() for cb in self._delete_callbacks]
@@ -534,4 +704,6 @@ class Table(object):
         """
         cache = {}
         for callback in self._update_callbacks:
-            callback["callback"](port_id=port_id, cache=cache)
+            callback["callback"](
+                port_id=port_id, cache=cache, dispatch=self._update_dispatch
+            )
@@ -17,6 +17,7 @@ from ._constants import COLUMN_SEPARATOR_STRING
 from ._utils import _str_to_pythontype
 from ._callback_cache import _PerspectiveCallBackCache
 from ._date_validator import _PerspectiveDateValidator
+from ..core.data.parquet import arrow_to_parquet
 from .libbinding import (
     make_view_unit,
     make_view_zero,
@@ -27,6 +28,7 @@ from .libbinding import (
     to_arrow_one,
     to_arrow_two,
     get_row_delta_unit,
+    get_row_delta_pkeys_unit,
     get_row_delta_zero,
     get_row_delta_one,
     get_row_delta_two,
@@ -441,6 +443,29 @@ class View(object):
                 options["end_col"],
             )
 
+    def to_parquet(self, path=None, compression="snappy", **options):
+        """Serialize the view's dataset into Parquet, through the same arrow
+        as :func:`to_arrow`. Requires `pyarrow`.
+
+        Keyword Args:
+            path (:obj:`str`/:obj:`pathlib.Path`): If set, the Parquet is
+                written to this path instead of being returned.
+            compression (:obj:`str`): The Parquet compression codec
+                (Defaults to ``"snappy"``).
+            start_row (:obj:`int`): (Defaults to 0).
+            end_row (:obj:`int`): (Defaults to
+                :func:`perspective.View.num_rows()`).
+            start_col (:obj:`int`): (Defaults to 0).
+            end_col (:obj:`int`): (Defaults to
+                :func:`perspective.View.num_columns()`).
+
+        Returns:
+            :obj:`bytes`: The Parquet binary, or ``None`` if ``path`` is set.
+        """
+        return arrow_to_parquet(
+            self.to_arrow(**options), path=path, compression=compression
+        )
+
     def to_records(self, **kwargs):
         """Serialize the :class:`~perspective.View`'s dataset into a :obj:`list`
         of :obj:`dict` containing each row.
@@ -504,6 +529,11 @@ class View(object):
         and :class:`numpy.array` values.  Each key is a column name, and the
         associated value is the column's data packed into a numpy array.
 
+        Columns are typed by their values: integer and boolean columns that
+        contain ``None`` are returned as :class:`numpy.ma.MaskedArray`, null
+        floats and datetimes are ``NaN`` and ``NaT``, and string columns are
+        ``object`` arrays.
+
         Keyword Args:
             start_row (:obj:`int`): (Defaults to 0).
             end_row (:obj:`int`): (Defaults to
@@ -606,6 +636,12 @@ class View(object):
         else:
             return get_row_delta_two(self._view)
 
+    def _get_row_delta_pkeys(self):
+        """The primary keys of the rows in the next `_get_row_delta()`, in
+        the same order. Only for views on unindexed tables without pivots,
+        filters, sorts or computed columns."""
+        return get_row_delta_pkeys_unit(self._view)
+
     def _num_hidden_cols(self):
         """Returns the number of columns that are sorted but not shown."""
         hidden = 0
@@ -623,13 +659,20 @@ class View(object):
         port_id = kwargs["port_id"]
         cache = kwargs["cache"]
         callback = kwargs["callback"]
+        dispatch = kwargs.get("dispatch")
 
         if cache.get(port_id) is None:
             cache[port_id] = {}
 
+        # The row delta is read here, before the next update replaces it,
+        # even if the callback itself is dispatched to an event loop.
+        args = (port_id,)
         if mode == "row":
             if cache[port_id].get("row_delta") is None:
                 cache["row_delta"] = self._get_row_delta()
-            callback(port_id, cache["row_delta"])
+            args = (port_id, cache["row_delta"])
+
+        if dispatch is not None:
+            dispatch(callback, *args)
         else:
-            callback(port_id)
+            callback(*args)
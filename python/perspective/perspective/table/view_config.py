@@ -31,6 +31,8 @@ class ViewConfig(object):
             filter (:obj:`list` of :obj:`list` of :obj:`str`):  A list of lists,
                 each list containing a column name, a filter comparator, and a
                 value to filter by.
+            limit (:obj:`int`): The maximum number of rows of a sorted view
+                without pivots, i.e. the first ``limit`` rows in sort order.
         """
         self._config = config
         self._row_pivots = self._config.get("row_pivots", [])
@@ -43,6 +45,7 @@ class ViewConfig(object):
         self._filter_op = self._config.get("filter_op", "and")
         self.row_pivot_depth = self._config.get("row_pivot_depth", None)
         self.column_pivot_depth = self._config.get("column_pivot_depth", None)
+        self.limit = self._config.get("limit", None)
 
     def get_row_pivots(self):
         """The columns used as
@@ -0,0 +1,165 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import json
+from pytest import raises
+from perspective import Table, PerspectiveError, PerspectiveManager
+from perspective.manager.protocol import (
+    FRAME_MESSAGE,
+    FRAME_UPDATE,
+    decode_frame,
+    encode_frame,
+    is_frame,
+)
+
+data = {"a": [1, 2, 3], "b": ["a", "b", "c"]}
+
+
+def _frame(id, header, payload=None):
+    return encode_frame(FRAME_MESSAGE, id, header=json.dumps(header), payload=payload)
+
+
+class TestPerspectiveProtocol(object):
+
+    def test_protocol_round_trip(self):
+        frame = encode_frame(FRAME_UPDATE, 7, header='{"a": 1}', payload=b"abc", port_id=3)
+        assert is_frame(frame)
+        decoded = decode_frame(frame)
+        assert decoded.kind == FRAME_UPDATE
+        assert decoded.id == 7
+        assert decoded.port_id == 3
+        assert decoded.header == {"a": 1}
+        assert decoded.payload == b"abc"
+
+    def test_protocol_empty_frame(self):
+        decoded = decode_frame(encode_frame(FRAME_MESSAGE, 1))
+        assert decoded.header is None
+        assert decoded.payload is None
+
+    def test_protocol_is_not_frame(self):
+        assert not is_frame(json.dumps({"id": 1}))
+        assert not is_frame(b"ARROW1")
+
+    def test_protocol_truncated_frame(self):
+        frame = encode_frame(FRAME_MESSAGE, 1, payload=b"abc")
+        with raises(ValueError):
+            decode_frame(frame[:-1])
+
+    def test_manager_binary_create_table(self):
+        posted = []
+        arrow = Table(data).view().to_arrow()
+        manager = PerspectiveManager()
+        manager._process(
+            _frame(1, {"cmd": "table", "name": "table1"}, arrow),
+            lambda msg, binary=False: posted.append((msg, binary)),
+        )
+        assert manager.get_table("table1").view().to_dict() == data
+        msg, binary = posted[0]
+        assert binary is True
+        decoded = decode_frame(msg)
+        assert decoded.id == 1
+        assert decoded.header == {"id": 1, "data": "table1"}
+
+    def test_manager_binary_update(self):
+        posted = []
+        manager = PerspectiveManager()
+        table = Table(data, index="a")
+        manager.host_table("table1", table)
+        arrow = Table({"a": [3, 4], "b": ["x", "y"]}).view().to_arrow()
+        manager._process(
+            _frame(1, {"cmd": "table_method", "name": "table1", "method": "update"}, arrow),
+            lambda msg, binary=False: posted.append((msg, binary)),
+        )
+        assert table.view().to_dict() == {"a": [1, 2, 3, 4], "b": ["a", "b", "x", "y"]}
+
+    def test_manager_binary_to_arrow(self):
+        posted = []
+        manager = PerspectiveManager()
+        manager.host_table("table1", Table(data))
+        manager._process(
+            {"id": 1, "table_name": "table1", "view_name": "view1", "cmd": "view"},
+            lambda msg, binary=False: None,
+        )
+        manager._process(
+            _frame(2, {"cmd": "view_method", "name": "view1", "method": "to_arrow", "args": [{}]}),
+            lambda msg, binary=False: posted.append((msg, binary)),
+        )
+        assert len(posted) == 1
+        decoded = decode_frame(posted[0][0])
+        assert decoded.id == 2
+        assert decoded.header is None
+        assert Table(decoded.payload).view().to_dict() == data
+
+    def test_manager_binary_error(self):
+        posted = []
+        manager = PerspectiveManager()
+        manager._process(
+            _frame(1, {"cmd": "view_method", "name": "view1", "method": "to_arrow", "args": [{}]}),
+            lambda msg, binary=False: posted.append((msg, binary)),
+        )
+        assert decode_frame(posted[0][0]).header == {"id": 1, "error": "View is not initialized"}
+
+    def test_manager_binary_invalid_frame(self):
+        manager = PerspectiveManager()
+        with raises(PerspectiveError):
+            manager._process(encode_frame(FRAME_UPDATE, 1), lambda msg, binary=False: None)
+
+    def test_manager_binary_on_update_row_delta(self):
+        posted = []
+        manager = PerspectiveManager()
+        table = Table(data)
+        manager.host_table("table1", table)
+        manager._process(
+            {"id": 1, "table_name": "table1", "view_name": "view1", "cmd": "view"},
+            lambda msg, binary=False: None,
+        )
+        manager._process(
+            _frame(2, {
+                "cmd": "view_method",
+                "name": "view1",
+                "method": "on_update",
+                "subscribe": True,
+                "callback_id": "callback_1",
+                "args": [{"mode": "row"}]
+            }),
+            lambda msg, binary=False: posted.append((msg, binary)),
+        )
+        table.update({"a": [4], "b": ["d"]})
+        assert len(posted) == 1
+        msg, binary = posted[0]
+        assert binary is True
+        decoded = decode_frame(msg)
+        assert decoded.kind == FRAME_UPDATE
+        assert decoded.id == 2
+        assert decoded.port_id == 0
+        assert decoded.header is None
+        assert Table(decoded.payload).view().to_dict() == {"a": [4], "b": ["d"]}
+
+    def test_manager_binary_on_update_none(self):
+        posted = []
+        manager = PerspectiveManager()
+        table = Table(data)
+        manager.host_table("table1", table)
+        manager._process(
+            {"id": 1, "table_name": "table1", "view_name": "view1", "cmd": "view"},
+            lambda msg, binary=False: None,
+        )
+        manager._process(
+            _frame(2, {
+                "cmd": "view_method",
+                "name": "view1",
+                "method": "on_update",
+                "subscribe": True,
+                "callback_id": "callback_1"
+            }),
+            lambda msg, binary=False: posted.append((msg, binary)),
+        )
+        table.update({"a": [4], "b": ["d"]})
+        decoded = decode_frame(posted[0][0])
+        assert decoded.kind == FRAME_UPDATE
+        assert decoded.payload is None
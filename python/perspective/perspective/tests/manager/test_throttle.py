@@ -0,0 +1,250 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import json
+import threading
+import time
+from pytest import raises
+from perspective import Table, PerspectiveError, PerspectiveManager
+from perspective.manager.throttle import (
+    _PerspectiveUpdateCoalescer,
+    _PerspectiveUpdateThrottle,
+)
+
+data = {"a": [1, 2, 3], "b": ["a", "b", "c"]}
+
+
+class _Client(object):
+    """Collects the notifications posted for a subscription."""
+
+    def __init__(self):
+        self.messages = []
+        self.deltas = []
+
+    def post(self, msg, binary=False):
+        if binary:
+            self.deltas.append(msg)
+        else:
+            self.messages.append(json.loads(msg))
+
+
+def _subscribe(session, client, mode="row", callback_id="callback_1"):
+    session.process(
+        {"id": 1, "table_name": "table1", "view_name": "view1", "cmd": "view"},
+        client.post,
+    )
+    session.process(
+        {
+            "id": 2,
+            "name": "view1",
+            "cmd": "view_method",
+            "subscribe": True,
+            "method": "on_update",
+            "callback_id": callback_id,
+            "args": [{"mode": mode}],
+        },
+        client.post,
+    )
+    client.messages = []
+
+
+class TestPerspectiveThrottle(object):
+
+    def test_throttle_sends_immediately_when_not_paused(self):
+        manager = PerspectiveManager()
+        table = Table(data, index="a")
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle()
+        client = _Client()
+        _subscribe(session, client)
+
+        table.update({"a": [1], "b": ["x"]})
+        table.update({"a": [2], "b": ["y"]})
+        assert len(client.deltas) == 2
+
+    def test_throttle_coalesces_indexed_deltas_while_paused(self):
+        manager = PerspectiveManager()
+        table = Table(data, index="a")
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle()
+        client = _Client()
+        _subscribe(session, client)
+
+        session.pause_updates()
+        table.update({"a": [1], "b": ["x"]})
+        table.update({"a": [1], "b": ["y"]})
+        table.update({"a": [4], "b": ["z"]})
+        assert client.deltas == []
+
+        session.resume_updates()
+        assert len(client.deltas) == 1
+        assert Table(client.deltas[0]).view().to_dict() == {
+            "a": [1, 4],
+            "b": ["y", "z"]
+        }
+
+    def test_throttle_drops_unindexed_deltas_while_paused(self):
+        manager = PerspectiveManager()
+        table = Table(data)
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle()
+        client = _Client()
+        _subscribe(session, client)
+
+        session.pause_updates()
+        port_id = table.make_port()
+        table.update({"a": [4], "b": ["x"]})
+        table.update({"a": [5], "b": ["y"]}, port_id=port_id)
+        session.resume_updates()
+
+        assert client.deltas == []
+        assert client.messages == [{"id": 2, "data": {"port_id": port_id}}]
+
+    def test_throttle_drops_merged_deltas_past_max_merged_rows(self):
+        manager = PerspectiveManager()
+        table = Table(data, index="a")
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle(max_merged_rows=2)
+        client = _Client()
+        _subscribe(session, client)
+
+        session.pause_updates()
+        table.update({"a": [1, 2], "b": ["x", "y"]})
+        table.update({"a": [3], "b": ["z"]})
+        table.update({"a": [4], "b": ["w"]})
+        session.resume_updates()
+
+        assert client.deltas == []
+        assert client.messages == [{"id": 2, "data": {"port_id": 0}}]
+
+        # The next pending delta is merged again.
+        session.pause_updates()
+        table.update({"a": [1], "b": ["v"]})
+        session.resume_updates()
+        assert len(client.deltas) == 1
+        assert Table(client.deltas[0]).view().to_dict() == {
+            "a": [1],
+            "b": ["v"]
+        }
+
+    def test_throttle_coalesces_notifications_without_delta(self):
+        manager = PerspectiveManager()
+        table = Table(data)
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle()
+        client = _Client()
+        _subscribe(session, client, mode="none")
+
+        session.pause_updates()
+        port_id = table.make_port()
+        table.update({"a": [4], "b": ["x"]})
+        table.update({"a": [5], "b": ["y"]}, port_id=port_id)
+        session.resume_updates()
+
+        assert client.messages == [{"id": 2, "data": {"port_id": port_id}}]
+
+    def test_throttle_max_update_rate(self):
+        timers = []
+        manager = PerspectiveManager()
+        table = Table(data, index="a")
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle(
+            max_update_rate=100, call_later=lambda delay, f: timers.append(f)
+        )
+        client = _Client()
+        _subscribe(session, client)
+
+        table.update({"a": [1], "b": ["x"]})
+        table.update({"a": [1], "b": ["y"]})
+        table.update({"a": [2], "b": ["z"]})
+        assert len(client.deltas) == 1
+        assert len(timers) == 1
+
+        time.sleep(0.02)
+        timers.pop()()
+        assert len(client.deltas) == 2
+        assert Table(client.deltas[1]).view().to_dict() == {
+            "a": [1, 2],
+            "b": ["y", "z"]
+        }
+
+    def test_throttle_max_update_rate_requires_call_later(self):
+        manager = PerspectiveManager()
+        session = manager.new_session()
+        with raises(PerspectiveError):
+            session.set_update_throttle(max_update_rate=10)
+
+    def test_throttle_remove_update_drops_pending(self):
+        manager = PerspectiveManager()
+        table = Table(data, index="a")
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle()
+        client = _Client()
+        _subscribe(session, client)
+
+        session.pause_updates()
+        table.update({"a": [1], "b": ["x"]})
+        session.process(
+            {
+                "id": 3,
+                "name": "view1",
+                "cmd": "view_method",
+                "subscribe": True,
+                "method": "remove_update",
+                "callback_id": "callback_1",
+            },
+            client.post,
+        )
+        session.resume_updates()
+        assert client.deltas == []
+
+    def test_throttle_close_session(self):
+        manager = PerspectiveManager()
+        table = Table(data, index="a")
+        manager.host_table("table1", table)
+        session = manager.new_session()
+        session.set_update_throttle()
+        client = _Client()
+        _subscribe(session, client)
+
+        session.pause_updates()
+        table.update({"a": [1], "b": ["x"]})
+        session.close()
+        assert manager._update_throttles == {}
+        table.update({"a": [1], "b": ["y"]})
+        assert client.deltas == []
+
+    def test_throttle_coalescer_from_another_thread(self):
+        throttle = _PerspectiveUpdateThrottle()
+        sent = []
+        coalescer = _PerspectiveUpdateCoalescer(
+            throttle, lambda port_id, delta=None: sent.append(delta)
+        )
+        throttle.add(coalescer)
+        delta = Table({"a": [1]}).view().to_arrow()
+
+        def notify():
+            for _ in range(200):
+                coalescer(0, delta)
+
+        thread = threading.Thread(target=notify)
+        thread.start()
+        for _ in range(50):
+            throttle.pause()
+            throttle.resume()
+        thread.join()
+        throttle.resume()
+
+        assert sum(Table(d).size() for d in sent) == 200
@@ -0,0 +1,219 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import threading
+from datetime import datetime
+from pytest import raises
+from perspective import Table, PerspectiveError
+from perspective.manager.protocol import decode_frame
+from perspective.replica import (
+    PerspectiveReplicaPublisher,
+    PerspectiveReplicaMirror,
+    PerspectiveLoopbackTransport,
+)
+
+data = {"a": [1, 2, 3], "b": ["a", "b", "c"]}
+
+
+class TestReplica(object):
+
+    def test_replica_snapshot(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        assert mirror.seq == 0
+        assert mirror.table.get_index() == "a"
+        assert mirror.table.view().to_dict() == data
+
+    def test_replica_update(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.update({"a": [2, 4], "b": ["x", "d"]})
+        table.update([{"a": 1, "b": None}])
+        table.view().to_dict()
+        assert mirror.seq == 2
+        assert mirror.table.view().to_dict() == table.view().to_dict()
+
+    def test_replica_partial_update(self):
+        table = Table({"a": [1, 2], "b": ["a", "b"], "c": [1.5, 2.5]}, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.update({"a": [1], "c": [3.5]})
+        assert mirror.table.view().to_dict() == {
+            "a": [1, 2],
+            "b": ["a", "b"],
+            "c": [3.5, 2.5]
+        }
+
+    def test_replica_unindexed_limit(self):
+        table = Table(data, limit=4)
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.update({"a": [4, 5], "b": ["d", "e"]})
+        table.view().to_dict()
+        assert mirror.table.get_limit() == 4
+        assert mirror.table.view().to_dict() == table.view().to_dict()
+
+    def test_replica_unindexed_limit_wrapped(self):
+        table = Table(data, limit=4)
+        table.update({"a": [4, 5], "b": ["d", "e"]})
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.update({"a": [6], "b": ["f"]})
+        table.view().to_dict()
+        assert table.view().to_dict() == {
+            "a": [5, 6, 3, 4],
+            "b": ["e", "f", "c", "d"]
+        }
+        assert mirror.table.view().to_dict() == table.view().to_dict()
+
+    def test_replica_unindexed_explicit_index_update(self):
+        table = Table(data)
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.update({"__INDEX__": [1], "b": ["x"]})
+        table.update({"a": [4], "b": ["d"]})
+        table.view().to_dict()
+        assert table.size() == 4
+        assert mirror.table.view().to_dict() == table.view().to_dict()
+
+    def test_replica_publishes_in_order_from_processing_thread(self):
+        table = Table({"a": int, "b": str}, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        received = []
+        publisher.subscribe(received.append)
+        table.start_processing_thread()
+
+        for i in range(200):
+            table.update([{"a": i, "b": str(i)}])
+            if i % 10 == 9:
+                table.remove([i - 5])
+
+        table.stop_processing_thread()
+        table.view().to_dict()
+        seqs = [decode_frame(message).id for message in received]
+        assert seqs == list(range(len(received)))
+
+        mirror = PerspectiveReplicaMirror()
+        for message in received:
+            mirror.receive(message)
+        assert mirror.table.view().to_dict() == table.view().to_dict()
+
+    def test_replica_remove(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.update({"a": [4], "b": ["d"]})
+        table.remove([1, 4])
+        table.view().to_dict()
+        assert mirror.table.view().to_dict() == {"a": [2, 3], "b": ["b", "c"]}
+
+    def test_replica_remove_datetime_index(self):
+        dates = [datetime(2020, 1, 1), datetime(2020, 1, 2)]
+        table = Table({"a": dates, "b": [1, 2]}, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.remove([dates[0]])
+        table.view().to_dict()
+        assert mirror.table.view().to_dict() == {"a": [dates[1]], "b": [2]}
+
+    def test_replica_remove_then_readd(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.remove([1])
+        table.update({"a": [1], "b": ["z"]})
+        table.view().to_dict()
+        assert mirror.table.view().to_dict() == table.view().to_dict()
+
+    def test_replica_clear_and_replace(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        table.clear()
+        assert mirror.table.size() == 0
+        table.replace({"a": [5], "b": ["e"]})
+        table.view().to_dict()
+        assert mirror.table.view().to_dict() == {"a": [5], "b": ["e"]}
+
+    def test_replica_late_subscriber(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        table.update({"a": [4], "b": ["d"]})
+        mirror = PerspectiveReplicaMirror()
+        publisher.subscribe(mirror.receive)
+        assert mirror.seq == 1
+        assert mirror.table.view().to_dict() == table.view().to_dict()
+        table.update({"a": [5], "b": ["e"]})
+        table.view().to_dict()
+        assert mirror.seq == 2
+        assert mirror.table.size() == 5
+
+    def test_replica_serializes_once(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        received = []
+        publisher.subscribe(received.append)
+        publisher.subscribe(received.append)
+        table.update({"a": [4], "b": ["d"]})
+        table.view().to_dict()
+        assert received[2] is received[3]
+
+    def test_replica_missed_message(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        received = []
+        publisher.subscribe(received.append)
+        table.update({"a": [4], "b": ["d"]})
+        table.update({"a": [5], "b": ["e"]})
+        table.view().to_dict()
+        mirror = PerspectiveReplicaMirror()
+        mirror.receive(received[0])
+        with raises(PerspectiveError):
+            mirror.receive(received[-1])
+
+    def test_replica_one_publisher_per_table(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        with raises(PerspectiveError):
+            PerspectiveReplicaPublisher(table)
+        publisher.delete()
+        PerspectiveReplicaPublisher(table)
+
+    def test_replica_loopback_thread(self):
+        table = Table(data, index="a")
+        publisher = PerspectiveReplicaPublisher(table)
+        transport = PerspectiveLoopbackTransport(publisher)
+        messages = transport.connect()
+        table.update({"a": [4], "b": ["d"]})
+        table.view().to_dict()
+        result = {}
+
+        def mirror_thread():
+            mirror = PerspectiveReplicaMirror()
+            result["count"] = mirror.drain(messages)
+            result["data"] = mirror.table.view().to_dict()
+
+        thread = threading.Thread(target=mirror_thread)
+        thread.start()
+        thread.join()
+
+        assert result["count"] == 2
+        assert result["data"] == table.view().to_dict()
+        transport.disconnect(messages)
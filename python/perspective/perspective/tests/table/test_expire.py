@@ -0,0 +1,95 @@
+# *****************************************************************************
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import threading
+import time
+from datetime import timedelta
+from pytest import raises
+from perspective.core.exception import PerspectiveError
+from perspective.table import Table
+
+
+def _now():
+    return int(time.time() * 1000)
+
+
+class TestExpire(object):
+
+    def test_expire_stale_rows(self):
+        now = _now()
+        tbl = Table({"a": [1, 2, 3], "t": [now - 100000, now, now - 200000]},
+                    index="a", expire_column="t", expire_after=60000)
+        tbl.update({"a": [4], "t": [now]})
+        assert tbl.view().to_dict()["a"] == [2, 4]
+
+    def test_expire_refreshed_row_is_kept(self):
+        now = _now()
+        tbl = Table({"a": [1, 2], "t": [now, now]},
+                    index="a", expire_column="t", expire_after=60000)
+        tbl.update({"a": [1], "t": [now - 100000]})
+        tbl.update({"a": [1], "t": [now]})
+        assert tbl.view().to_dict()["a"] == [1, 2]
+
+    def test_expire_timedelta(self):
+        now = _now()
+        tbl = Table({"a": [1, 2], "t": [now - 100000, now]},
+                    index="a", expire_column="t",
+                    expire_after=timedelta(minutes=1))
+        tbl.update({"a": [3], "t": [now]})
+        assert tbl.view().to_dict()["a"] == [2, 3]
+
+    def test_expire_sum(self):
+        now = _now()
+        tbl = Table({"a": [1, 2, 3], "x": [1, 2, 3], "t": [now - 100000, now, now]},
+                    index="a", expire_column="t", expire_after=60000)
+        view = tbl.view(aggregates={"x": "sum"}, row_pivots=["a"])
+        tbl.update({"a": [4], "x": [4], "t": [now]})
+        assert view.to_dict()["x"] == [9, 2, 3, 4]
+
+    def test_expire_requires_window(self):
+        with raises(PerspectiveError):
+            Table({"a": [1], "t": [1]}, expire_column="t")
+
+    def test_expire_deadline(self):
+        now = _now()
+        tbl = Table({"a": [1, 2], "t": [now - 1000, now]},
+                    index="a", expire_column="t", expire_after=60000)
+        pool = tbl._table.get_pool()
+        assert pool.get_expiry_deadline() == now - 1000 + 60000 + 1
+
+        tbl.clear()
+        tbl.update({"a": [3], "t": [now]})
+        assert pool.get_expiry_deadline() == now + 60000 + 1
+
+    def test_expire_no_deadline(self):
+        tbl = Table({"a": [1], "t": [_now()]})
+        assert tbl._table.get_pool().get_expiry_deadline() == -1
+
+    def test_expire_idle_table_on_processing_thread(self):
+        now = _now()
+        tbl = Table({"a": [1, 2], "t": [now - 59000, now]},
+                    index="a", expire_column="t", expire_after=60000)
+        view = tbl.view()
+        expired = threading.Event()
+        view.on_update(lambda port_id: expired.set())
+
+        # No update follows - the processing thread wakes for the deadline.
+        tbl.start_processing_thread()
+        assert expired.wait(5)
+        tbl.stop_processing_thread()
+        assert view.to_dict()["a"] == [2]
+
+    def test_expire_max_min(self):
+        now = _now()
+        tbl = Table({"a": [1, 2, 3], "x": [10, 2, 3], "t": [now - 100000, now, now]},
+                    index="a", expire_column="t", expire_after=60000)
+        high = tbl.view(aggregates={"x": "max"}, row_pivots=["a"])
+        low = tbl.view(aggregates={"x": "min"}, row_pivots=["a"])
+        tbl.update({"a": [4], "x": [1], "t": [now]})
+        assert high.to_dict()["x"] == [3, 2, 3, 1]
+        assert low.to_dict()["x"] == [1, 2, 3, 1]
@@ -8,6 +8,7 @@
 #
 import six
 import sys
+import numpy as np
 from datetime import date, datetime
 from pytest import raises
 from perspective.table import Table
@@ -582,6 +583,18 @@ class TestTable(object):
             {"a": 3, "b": 4}
         ]
 
+    def test_table_limit_wraps_across_updates(self):
+        tbl = Table({"a": [1, 2]}, limit=3)
+        tbl.update({"a": [3, 4, 5]})
+        assert tbl.size() == 3
+        assert tbl.view().to_dict() == {"a": [4, 5, 3]}
+
+    def test_table_limit_wraps_across_numpy_updates(self):
+        tbl = Table({"a": np.array([1, 2])}, limit=3)
+        tbl.update({"a": np.array([3, 4, 5])})
+        assert tbl.size() == 3
+        assert tbl.view().to_dict() == {"a": [4, 5, 3]}
+
     def test_table_get_limit(self):
         data = [{"a": 1, "b": 2}, {"a": 3, "b": 4}]
         tbl = Table(data, limit=1)
@@ -534,3 +534,81 @@ class TestTableArrow(object):
         json = tbl.view().to_columns()
 
         assert json["a"] == [1.5, 2.5, None, 3.5, 4.5, None, None, None]
+
+    # record batches
+
+    def test_table_arrow_loads_multiple_batches_stream(self):
+        batches = [
+            pa.RecordBatch.from_arrays([pa.array([i * 2, i * 2 + 1]), pa.array(["a", "b"])], ["a", "b"])
+            for i in range(3)
+        ]
+        stream = pa.BufferOutputStream()
+        writer = pa.RecordBatchStreamWriter(stream, batches[0].schema)
+        for batch in batches:
+            writer.write_batch(batch)
+        writer.close()
+
+        tbl = Table(stream.getvalue().to_pybytes())
+        assert tbl.size() == 6
+        assert tbl.view().to_dict() == {
+            "a": [0, 1, 2, 3, 4, 5],
+            "b": ["a", "b", "a", "b", "a", "b"]
+        }
+
+    def test_table_arrow_loads_multiple_batches_stream_indexed(self):
+        batches = [
+            pa.RecordBatch.from_arrays([pa.array([1, 2]), pa.array([i, i])], ["a", "b"])
+            for i in range(3)
+        ]
+        stream = pa.BufferOutputStream()
+        writer = pa.RecordBatchStreamWriter(stream, batches[0].schema)
+        for batch in batches:
+            writer.write_batch(batch)
+        writer.close()
+
+        tbl = Table(stream.getvalue().to_pybytes(), index="a")
+        assert tbl.view().to_dict() == {
+            "a": [1, 2],
+            "b": [2, 2]
+        }
+
+    def test_table_arrow_loads_file_path(self, tmpdir):
+        path = str(tmpdir.join("data.arrow"))
+        batch = pa.RecordBatch.from_arrays([pa.array([1, 2, 3]), pa.array([1.5, 2.5, 3.5])], ["a", "b"])
+        with pa.OSFile(path, "wb") as sink:
+            writer = pa.RecordBatchFileWriter(sink, batch.schema)
+            writer.write_batch(batch)
+            writer.write_batch(batch)
+            writer.close()
+
+        tbl = Table(tmpdir.join("data.arrow"))
+        assert tbl.size() == 6
+        assert tbl.view().to_dict()["b"] == [1.5, 2.5, 3.5, 1.5, 2.5, 3.5]
+
+    def test_table_arrow_update_file_path_notifies_once(self, tmpdir):
+        path = str(tmpdir.join("update.arrow"))
+        batch = pa.RecordBatch.from_arrays([pa.array([1, 2, 3]), pa.array([1.5, 2.5, 3.5])], ["a", "b"])
+        with pa.OSFile(path, "wb") as sink:
+            writer = pa.RecordBatchFileWriter(sink, batch.schema)
+            writer.write_batch(batch)
+            writer.write_batch(batch)
+            writer.write_batch(batch)
+            writer.close()
+
+        tbl = Table({"a": int, "b": float})
+        view = tbl.view()
+        calls = []
+        view.on_update(lambda port_id: calls.append(port_id))
+        tbl.update(tmpdir.join("update.arrow"))
+        assert len(calls) == 1
+        assert tbl.size() == 9
+
+    def test_table_arrow_loads_empty_stream(self):
+        schema = pa.schema([("a", pa.int64())])
+        stream = pa.BufferOutputStream()
+        writer = pa.RecordBatchStreamWriter(stream, schema)
+        writer.close()
+
+        tbl = Table(stream.getvalue().to_pybytes())
+        assert tbl.size() == 0
+        assert tbl.schema() == {"a": int}
@@ -0,0 +1,74 @@
+# *****************************************************************************
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+from perspective.table import Table
+
+CSV = "a,b,c\n1,1.5,x\n2,2.5,y\n3,3.5,z\n"
+
+
+class TestTableCSV(object):
+
+    def test_table_csv_string(self):
+        tbl = Table(CSV)
+        assert tbl.size() == 3
+        assert tbl.schema() == {
+            "a": int,
+            "b": float,
+            "c": str
+        }
+        assert tbl.view().to_dict() == {
+            "a": [1, 2, 3],
+            "b": [1.5, 2.5, 3.5],
+            "c": ["x", "y", "z"]
+        }
+
+    def test_table_csv_string_update(self):
+        tbl = Table(CSV, index="a")
+        tbl.update("a,b,c\n2,20.5,yy\n4,4.5,w\n")
+        assert tbl.view().to_dict() == {
+            "a": [1, 2, 3, 4],
+            "b": [1.5, 20.5, 3.5, 4.5],
+            "c": ["x", "yy", "z", "w"]
+        }
+
+    def test_table_csv_file(self, tmpdir):
+        path = tmpdir.join("data.csv")
+        path.write(CSV)
+        tbl = Table(path)
+        assert tbl.view().to_dict() == {
+            "a": [1, 2, 3],
+            "b": [1.5, 2.5, 3.5],
+            "c": ["x", "y", "z"]
+        }
+
+    def test_table_csv_file_update(self, tmpdir):
+        path = tmpdir.join("update.csv")
+        path.write("a,b,c\n4,4.5,w\n")
+        tbl = Table(CSV)
+        tbl.update(path)
+        assert tbl.size() == 4
+        assert tbl.view().to_dict()["c"] == ["x", "y", "z", "w"]
+
+    def test_table_csv_update_many_blocks(self):
+        # Larger than arrow's 1MB block size, so it is read as several record
+        # batches, which must still be applied as a single update.
+        rows = 200000
+        csv = "a,b,c\n" + "".join(
+            "{},{}.5,s{}\n".format(i, i, i % 10) for i in range(rows)
+        )
+        tbl = Table(CSV, index="a")
+        view = tbl.view()
+        updates = []
+        view.on_update(lambda port_id: updates.append(port_id))
+        tbl.update(csv)
+        assert tbl.size() == rows
+        assert len(updates) == 1
+        data = view.to_columns()
+        assert data["a"][-1] == rows - 1
+        assert data["b"][1] == 1.5
+        assert data["c"][rows - 1] == "s9"
@@ -0,0 +1,80 @@
+# *****************************************************************************
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+from pytest import importorskip
+from perspective.table import Table
+
+pa = importorskip("pyarrow")
+pq = importorskip("pyarrow.parquet")
+
+
+def _to_parquet(data, **kwargs):
+    sink = pa.BufferOutputStream()
+    pq.write_table(pa.table(data), sink, **kwargs)
+    return sink.getvalue().to_pybytes()
+
+
+class TestTableParquet(object):
+
+    def test_table_parquet_loads(self):
+        data = {"a": [1, 2, 3], "b": [1.5, 2.5, 3.5], "c": ["x", "y", "x"]}
+        tbl = Table(_to_parquet(data))
+        assert tbl.schema() == {"a": int, "b": float, "c": str}
+        assert tbl.view().to_dict() == data
+
+    def test_table_parquet_loads_row_groups(self):
+        data = {"a": list(range(100)), "b": [str(i % 7) for i in range(100)]}
+        tbl = Table(_to_parquet(data, row_group_size=9))
+        assert tbl.size() == 100
+        assert tbl.view().to_dict() == data
+
+    def test_table_parquet_loads_row_groups_indexed(self):
+        data = {"a": list(range(100)), "b": [str(i % 7) for i in range(100)]}
+        tbl = Table(_to_parquet(data, row_group_size=9), index="a")
+        assert tbl.size() == 100
+        assert tbl.view().to_dict() == data
+
+    def test_table_parquet_loads_file(self, tmp_path):
+        data = {"a": [1, 2, 3], "b": ["x", "y", "z"]}
+        path = tmp_path / "data.parquet"
+        pq.write_table(pa.table(data), str(path))
+        tbl = Table(path)
+        assert tbl.view().to_dict() == data
+
+    def test_table_parquet_loads_empty(self):
+        tbl = Table(_to_parquet({"a": pa.array([], pa.int64()), "b": pa.array([], pa.string())}))
+        assert tbl.size() == 0
+        assert tbl.schema() == {"a": int, "b": str}
+
+    def test_table_parquet_update_projects_columns(self):
+        tbl = Table({"a": [1, 2], "b": ["x", "y"]}, index="a")
+        tbl.update(_to_parquet({"a": [2, 3], "b": ["z", "w"], "c": [1.5, 2.5]}))
+        assert tbl.view().to_dict() == {"a": [1, 2, 3], "b": ["x", "z", "w"]}
+
+    def test_table_parquet_update_notifies_once(self):
+        data = {"a": list(range(100)), "b": [str(i % 7) for i in range(100)]}
+        tbl = Table({"a": [0], "b": ["x"]}, index="a")
+        calls = []
+        tbl.view().on_update(lambda port_id: calls.append(port_id))
+        tbl.update(_to_parquet(data, row_group_size=9))
+        assert len(calls) == 1
+        assert tbl.view().to_dict() == data
+
+    def test_view_to_parquet_round_trip(self):
+        data = {"a": [1, 2, 3], "b": [1.5, 2.5, 3.5], "c": ["x", "y", "x"]}
+        tbl = Table(data)
+        parquet = tbl.view().to_parquet()
+        assert parquet[:4] == b"PAR1"
+        assert pq.read_table(pa.BufferReader(parquet)).to_pydict() == data
+        assert Table(parquet).view().to_dict() == data
+
+    def test_view_to_parquet_path(self, tmp_path):
+        data = {"a": [1, 2, 3]}
+        path = tmp_path / "data.parquet"
+        assert Table(data).view().to_parquet(path=path) is None
+        assert Table(path).view().to_dict() == data
@@ -0,0 +1,275 @@
+################################################################################
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import gc
+import threading
+from datetime import timedelta
+from pytest import raises
+from perspective import Table, PerspectiveError
+
+
+def run_threads(target, args_list):
+    threads = [threading.Thread(target=target, args=args) for args in args_list]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+
+class TestTableThreads(object):
+    def test_update_separate_tables_from_threads(self):
+        tables = [Table({"a": int, "b": float}, index="a") for _ in range(4)]
+
+        def update(tbl, offset):
+            for i in range(50):
+                tbl.update([{"a": i, "b": i + offset}])
+                tbl.view().to_arrow()
+
+        run_threads(update, [(tbl, i) for i, tbl in enumerate(tables)])
+
+        for i, tbl in enumerate(tables):
+            assert tbl.size() == 50
+            assert tbl.view().to_dict()["b"] == [float(j + i) for j in range(50)]
+
+    def test_update_same_table_from_threads(self):
+        tbl = Table({"a": int, "b": int}, index="a")
+        view = tbl.view(row_pivots=["b"], aggregates={"a": "count"})
+
+        def update(offset):
+            for i in range(50):
+                tbl.update([{"a": offset * 50 + i, "b": offset}])
+                view.to_arrow()
+
+        run_threads(update, [(i,) for i in range(4)])
+
+        assert tbl.size() == 200
+        assert view.to_dict()["a"] == [200, 50, 50, 50, 50]
+
+    def test_update_callback_from_threads(self):
+        tbl = Table({"a": int}, index="a")
+        view = tbl.view()
+        lock = threading.Lock()
+        updates = []
+
+        def callback(port_id, delta):
+            # Reading back from the same view inside the callback re-enters
+            # the engine on the notifying thread.
+            with lock:
+                updates.append(Table(delta).size())
+
+        view.on_update(callback, mode="row")
+
+        def update(offset):
+            for i in range(25):
+                tbl.update([{"a": offset * 25 + i}])
+
+        run_threads(update, [(i,) for i in range(4)])
+
+        assert tbl.size() == 100
+        assert sum(updates) == 100
+
+    # processing thread
+
+    def test_processing_thread_applies_updates(self):
+        tbl = Table({"a": int, "b": int}, index="a")
+        view = tbl.view()
+        done = threading.Event()
+
+        def callback(port_id):
+            if view.num_rows() == 10:
+                done.set()
+
+        view.on_update(callback)
+        tbl.start_processing_thread()
+
+        for i in range(10):
+            tbl.update([{"a": i, "b": i * 2}])
+
+        assert done.wait(5)
+        tbl.stop_processing_thread()
+        assert view.to_dict() == {
+            "a": list(range(10)),
+            "b": [i * 2 for i in range(10)]
+        }
+
+    def test_processing_thread_coalesces_within_window(self):
+        tbl = Table({"a": int}, index="a")
+        view = tbl.view()
+        lock = threading.Lock()
+        done = threading.Event()
+        deltas = []
+
+        def callback(port_id, delta):
+            with lock:
+                deltas.append(Table(delta).size())
+                if sum(deltas) == 20:
+                    done.set()
+
+        view.on_update(callback, mode="row")
+        tbl.start_processing_thread(window=timedelta(milliseconds=250))
+
+        for i in range(20):
+            tbl.update([{"a": i}])
+
+        assert done.wait(5)
+        tbl.stop_processing_thread()
+        assert len(deltas) < 20
+
+    def test_processing_thread_posts_callbacks(self):
+        tbl = Table({"a": int})
+        view = tbl.view()
+        posted = []
+        done = threading.Event()
+
+        def loop_callback(f, *args):
+            posted.append((f, args))
+            done.set()
+
+        received = []
+        view.on_update(lambda port_id, delta: received.append(port_id), mode="row")
+        tbl.start_processing_thread(loop_callback=loop_callback)
+        tbl.update({"a": [1, 2, 3]})
+
+        assert done.wait(5)
+        tbl.stop_processing_thread()
+
+        # The callback only runs once the loop calls it.
+        assert received == []
+        f, args = posted[0]
+        f(*args)
+        assert received == [0]
+        assert Table(args[1]).view().to_dict() == {"a": [1, 2, 3]}
+
+    def test_processing_thread_max_rows_ends_window(self):
+        tbl = Table({"a": int})
+        view = tbl.view()
+        done = threading.Event()
+
+        def callback(port_id):
+            if view.num_rows() == 10:
+                done.set()
+
+        view.on_update(callback)
+        before = tbl.update_metrics()
+        tbl.start_processing_thread(window=timedelta(seconds=60), max_rows=10)
+
+        for i in range(10):
+            tbl.update([{"a": i}])
+
+        assert done.wait(5)
+        tbl.stop_processing_thread()
+        after = tbl.update_metrics()
+        assert after["queued_batches"] == 0
+        assert after["queued_rows"] == 0
+        assert after["num_processed"] - before["num_processed"] == 1
+        assert after["batches_processed"] - before["batches_processed"] == 10
+        assert after["rows_processed"] - before["rows_processed"] == 10
+        assert after["max_batch_rows"] == 10
+
+    def test_processing_thread_invalid_max_rows(self):
+        tbl = Table({"a": int})
+        with raises(PerspectiveError):
+            tbl.start_processing_thread(max_rows=0)
+
+    def test_update_metrics(self):
+        tbl = Table({"a": int})
+        before = tbl.update_metrics()
+        tbl.update({"a": [1, 2, 3]})
+        tbl.update({"a": [4]})
+        assert tbl.size() == 4
+        after = tbl.update_metrics()
+        assert after["queued_batches"] == 0
+        assert after["batches_processed"] - before["batches_processed"] == 2
+        assert after["rows_processed"] - before["rows_processed"] == 4
+
+    def test_processing_thread_concurrent_views(self):
+        tbl = Table({"a": int, "b": str}, index="a")
+        tbl.start_processing_thread()
+
+        def update():
+            for i in range(200):
+                tbl.update([{"a": i % 50, "b": str(i)}])
+
+        def read():
+            for _ in range(50):
+                view = tbl.view(row_pivots=["b"])
+                view.num_rows()
+                view.schema()
+                view.get_min_max("a")
+                tbl.size()
+                tbl.schema()
+                view.delete()
+
+        run_threads(lambda f: f(), [(update,), (read,), (read,)])
+        tbl.stop_processing_thread()
+        assert tbl.size() == 50
+
+    def test_processing_thread_views_created_and_deleted_while_notifying(self):
+        # Views are created and deleted with the GIL held, while the
+        # processing thread holds the engine lock and waits on the GIL to
+        # notify `on_update`.
+        tbl = Table({"a": int, "b": str}, index="a")
+        view = tbl.view()
+        updates = []
+        view.on_update(lambda port_id: updates.append(port_id))
+        tbl.start_processing_thread()
+
+        done = threading.Event()
+
+        def update():
+            for i in range(500):
+                tbl.update([{"a": i % 50, "b": str(i)}])
+            done.set()
+
+        thread = threading.Thread(target=update)
+        thread.start()
+        while not done.is_set():
+            extra = tbl.view(row_pivots=["b"])
+            extra.num_rows()
+            extra.delete()
+            del extra
+        thread.join()
+
+        tbl.stop_processing_thread()
+        assert tbl.size() == 50
+        assert len(updates) > 0
+
+    def test_processing_thread_stop_restores_synchronous_update(self):
+        tbl = Table({"a": int})
+        tbl.start_processing_thread(window=10)
+        tbl.stop_processing_thread()
+        tbl.update({"a": [1]})
+        assert tbl.view().to_dict() == {"a": [1]}
+
+    def test_processing_thread_delete(self):
+        tbl = Table({"a": int})
+        tbl.start_processing_thread()
+        tbl.update({"a": [1, 2]})
+        tbl.delete()
+
+    def test_processing_thread_delete_from_update_callback(self):
+        tables = {"tbl": Table({"a": int})}
+        tables["view"] = tables["tbl"].view()
+        deleted = threading.Event()
+
+        def callback(port_id):
+            tables["view"].delete()
+            tables["tbl"].delete()
+            tables.clear()
+            deleted.set()
+
+        tables["view"].on_update(callback)
+        tables["tbl"].start_processing_thread()
+        tables["tbl"].update({"a": [1, 2]})
+        assert deleted.wait(5)
+        gc.collect()
+
+        # The pool is released by its own processing thread once the callback
+        # returns.
+        tbl = Table({"a": [1]})
+        assert tbl.size() == 1
@@ -370,6 +370,93 @@ class TestToFormat(object):
         assert np.array_equal(v["2|a"], np.array([1, 1]))
         assert np.array_equal(v["2|b"], np.array([2, 2]))
 
+    def test_to_numpy_int_none_is_masked(self):
+        data = {"a": [1, None, 3]}
+        tbl = Table(data)
+        view = tbl.view()
+        v = view.to_numpy()
+        assert isinstance(v["a"], np.ma.MaskedArray)
+        assert v["a"].dtype == np.int64
+        assert v["a"].mask.tolist() == [False, True, False]
+        assert v["a"].tolist() == [1, None, 3]
+
+    def test_to_numpy_bool_none_is_masked(self):
+        data = {"a": [True, None, False]}
+        tbl = Table(data)
+        view = tbl.view()
+        v = view.to_numpy()
+        assert v["a"].dtype == np.bool_
+        assert v["a"].tolist() == [True, None, False]
+
+    def test_to_numpy_float_none_is_nan(self):
+        data = {"a": [1.5, None, 3.5]}
+        tbl = Table(data)
+        view = tbl.view()
+        v = view.to_numpy()
+        assert v["a"].dtype == np.float64
+        assert v["a"][0] == 1.5
+        assert np.isnan(v["a"][1])
+        assert v["a"][2] == 3.5
+
+    def test_to_numpy_datetime_none_is_nat(self):
+        dt = datetime(2019, 3, 15, 20, 30, 59, 6000)
+        data = {"a": [dt, None]}
+        tbl = Table(data)
+        view = tbl.view()
+        v = view.to_numpy()
+        assert v["a"].dtype == np.dtype("datetime64[ms]")
+        assert v["a"][0] == np.datetime64(dt)
+        assert np.isnat(v["a"][1])
+
+    def test_to_numpy_date_typed(self):
+        data = {"a": [date(2019, 7, 11), date(1969, 12, 31), None]}
+        tbl = Table(data)
+        view = tbl.view()
+        v = view.to_numpy()
+        assert v["a"].dtype == np.dtype("datetime64[ms]")
+        assert v["a"][0] == np.datetime64("2019-07-11")
+        assert v["a"][1] == np.datetime64("1969-12-31")
+        assert np.isnat(v["a"][2])
+
+    def test_to_numpy_string_none(self):
+        data = {"a": ["abc", None, "abc"]}
+        tbl = Table(data)
+        view = tbl.view()
+        v = view.to_numpy()
+        assert v["a"].dtype == np.object_
+        assert v["a"].tolist() == ["abc", None, "abc"]
+
+    def test_to_numpy_leaves_only(self):
+        data = [{"a": 1, "b": 2}, {"a": 3, "b": 4}]
+        tbl = Table(data)
+        view = tbl.view(row_pivots=["a"])
+        v = view.to_numpy(leaves_only=True)
+        assert np.array_equal(v["__ROW_PATH__"], [[1], [3]])
+        assert np.array_equal(v["a"], np.array([1, 3]))
+        assert np.array_equal(v["b"], np.array([2, 4]))
+
+    def test_to_numpy_matches_to_dict_pivoted(self):
+        data = {"a": [1, 2, None, 4], "b": ["x", "y", "x", None], "c": [1.5, None, 2.5, 3.5]}
+        tbl = Table(data)
+        view = tbl.view(row_pivots=["b"], column_pivots=["a"])
+        records = view.to_dict()
+        v = view.to_numpy()
+        assert list(v.keys()) == list(records.keys())
+        for name in records:
+            if name == "__ROW_PATH__":
+                continue
+            for x, y in zip(v[name].tolist(), records[name]):
+                assert x == y or (x is None and y is None) or (x != x and y is None)
+
+    def test_to_df_int_none(self):
+        data = {"a": [1, None, 3]}
+        tbl = Table(data)
+        view = tbl.view()
+        df = view.to_df()
+        assert df["a"].tolist()[0] == 1
+        assert np.isnan(df["a"].tolist()[1])
+        assert df["a"].tolist()[2] == 3
+
     def test_to_pandas_df_simple(self):
         data = [{"a": 1, "b": 2}, {"a": 1, "b": 2}]
         df = pd.DataFrame(data)
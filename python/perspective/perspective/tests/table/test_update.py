@@ -483,3 +483,104 @@ class TestUpdate(object):
             "b": 3
         }])
         assert view.to_records() == [{"a": 1, "b": 3}, {"a": 2, "b": 3}]
+
+    def test_update_churning_strings(self):
+        tbl = Table({"a": int, "b": str}, index="a")
+        view = tbl.view()
+        for i in range(10):
+            tbl.update({"a": list(range(1000)), "b": ["{}-{}".format(i, j) for j in range(1000)]})
+        tbl.remove([0, 1])
+        records = view.to_dict()
+        assert records["a"] == list(range(2, 1000))
+        assert records["b"] == ["9-{}".format(j) for j in range(2, 1000)]
+
+        # Overwritten strings are compacted away as the table churns, so the
+        # vocab never holds much more than the compaction threshold of 4096
+        # strings plus one update.
+        assert tbl._table.get_vocab_size("b") <= 4096 + 1000 + 1
+
+        # Explicit compaction leaves the 998 live strings, and id 0 which is
+        # always kept for null rows
+        tbl._table.compact_vocabularies()
+        assert 998 <= tbl._table.get_vocab_size("b") <= 998 + 1
+        records = view.to_dict()
+        assert records["a"] == list(range(2, 1000))
+        assert records["b"] == ["9-{}".format(j) for j in range(2, 1000)]
+
+    def test_update_compacts_strings_of_deleted_rows(self):
+        tbl = Table({"a": [1, 2, 3, 4], "b": ["x", "y", "z", "x"]}, index="a")
+        view = tbl.view()
+        assert tbl._table.get_vocab_size("b") == 3
+
+        # "z" is only referenced by the deleted row, "x" is still held by row 1
+        tbl.remove([3, 4])
+        assert tbl._table.compact_vocabularies() == 1
+        assert tbl._table.get_vocab_size("b") == 2
+        assert view.to_dict() == {"a": [1, 2], "b": ["x", "y"]}
+
+        # Compacted ids are remapped, so new and old strings still resolve
+        tbl.update({"a": [3, 5], "b": ["z", "y"]})
+        assert tbl._table.get_vocab_size("b") == 3
+        assert view.to_dict() == {"a": [1, 2, 3, 5], "b": ["x", "y", "z", "y"]}
+
+    def test_update_records_mixed_numeric(self):
+        tbl = Table({"a": int, "b": float})
+        tbl.update([{"a": 1.9, "b": 2}, {"a": float("nan"), "b": 3.5}, {"a": 3}])
+        assert tbl.view().to_dict() == {"a": [1, None, 3], "b": [2.0, 3.5, None]}
+
+    def test_update_columns_mixed_numeric(self):
+        tbl = Table({"a": int, "b": float})
+        tbl.update({"a": [1.9, None, 3], "b": [2, float("nan"), 3.5]})
+        assert tbl.view().to_dict() == {"a": [1, None, 3], "b": [2.0, None, 3.5]}
+
+    def test_update_int64_exact(self):
+        tbl = Table({"a": int})
+        tbl.update([{"a": 2 ** 53 + 1}, {"a": -(2 ** 62)}])
+        assert tbl.view().to_dict() == {"a": [2 ** 53 + 1, -(2 ** 62)]}
+
+    def test_update_records_partial_keeps_missing_columns(self):
+        tbl = Table({"a": [1, 2], "b": ["x", "y"], "c": [True, False]}, index="a")
+        tbl.update([{"a": 1, "c": False}, {"a": 2, "b": None}])
+        assert tbl.view().to_dict() == {"a": [1, 2], "b": ["x", None], "c": [False, False]}
+
+    def test_update_marshals_non_native_values(self):
+        class Custom(object):
+            def _psp_repr_(self):
+                return "custom"
+
+        tbl = Table({"a": str, "b": bool, "c": float})
+        tbl.update([{"a": Custom(), "b": "yes", "c": [1.5]}, {"a": 1, "b": 0, "c": True}])
+        assert tbl.view().to_dict() == {"a": ["custom", "1"], "b": [True, False], "c": [1.5, 1.0]}
+
+    def test_update_new_keys_updates_views(self):
+        tbl = Table({"a": [1, 2], "b": ["x", "y"], "c": [1.5, 2.5]}, index="a")
+        flat = tbl.view(filter=[["c", ">", 2]], sort=[["c", "desc"]])
+        pivot = tbl.view(row_pivots=["b"], columns=["c"])
+        tbl.update({"a": [3, 4], "b": ["x", "z"], "c": [3.5, 0.5]})
+        assert flat.to_dict() == {"a": [3, 2], "b": ["x", "y"], "c": [3.5, 2.5]}
+        assert pivot.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["y"], ["z"]],
+            "c": [8, 5, 2.5, 0.5]
+        }
+        tbl.update({"a": [1, 5], "b": ["z", "y"], "c": [4.5, 1]})
+        assert flat.to_dict() == {"a": [1, 3, 2], "b": ["z", "x", "y"], "c": [4.5, 3.5, 2.5]}
+        assert pivot.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["y"], ["z"]],
+            "c": [12, 3.5, 3.5, 5]
+        }
+
+    def test_update_existing_keys_updates_views_on_some_columns(self):
+        tbl = Table({"a": [1, 2, 3], "b": ["x", "y", "x"], "c": [1, 2, 3], "d": [4, 5, 6]}, index="a")
+        flat = tbl.view(filter=[["c", ">", 1]])
+        pivot = tbl.view(row_pivots=["b"], columns=["d"])
+        tbl.update({"a": [1, 2], "c": [5, 0], "d": [10, 20]})
+        assert flat.to_dict() == {"a": [1, 3], "b": ["x", "x"], "c": [5, 3], "d": [10, 6]}
+        assert pivot.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["y"]],
+            "d": [36, 16, 20]
+        }
+        tbl.update({"a": [3], "b": ["y"]})
+        assert pivot.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["y"]],
+            "d": [36, 10, 26]
+        }
@@ -864,6 +864,20 @@ class TestUpdateArrow(object):
             "b": ["z", "x", "y"]
         }
 
+    def test_update_arrow_updates_dictionary_stream_existing_vocab(self, util):
+        data = [
+            ([0, 1, 1, None], ["y", "z"]),
+        ]
+        arrow_data = util.make_dictionary_arrow(["a"], data)
+        tbl = Table({
+            "a": ["z", "x"]
+        })
+        tbl.update(arrow_data)
+
+        assert tbl.view().to_dict() == {
+            "a": ["z", "x", "y", "z", "z", None]
+        }
+
     @mark.skip
     def test_update_arrow_partial_updates_dictionary_stream_duplicates(self, util):
         """If there are duplicate values in the dictionary, primary keys
@@ -7,7 +7,8 @@
 #
 import numpy as np
 from datetime import date, datetime
-from pytest import mark
+from pytest import mark, raises
+from perspective import PerspectiveCppError
 from perspective.table import Table
 
 
@@ -308,3 +309,99 @@ class TestUpdateNumpy(object):
             "index": list(range(5)),
             "a": [None for _ in range(5)]
         }
+
+    # datetime64 and mismatched widths
+
+    def test_update_np_datetime64_units(self):
+        tbl = Table({"a": datetime})
+        expected = datetime(2019, 7, 12, 11, 30, 15)
+
+        for unit in ["s", "ms", "us", "ns"]:
+            tbl.update({"a": np.array([expected], dtype="datetime64[{}]".format(unit))})
+
+        tbl.update({"a": np.array([expected], dtype="datetime64[m]")})
+        tbl.update({"a": np.array([expected], dtype="datetime64[h]")})
+
+        assert tbl.view().to_dict()["a"] == [expected] * 4 + [
+            datetime(2019, 7, 12, 11, 30),
+            datetime(2019, 7, 12, 11, 0)
+        ]
+
+    def test_update_np_datetime64_multiple_unit(self):
+        tbl = Table({"a": datetime})
+        tbl.update({"a": np.array(["2019-07-12T11:30:15.120"], dtype="datetime64[10ms]")})
+        assert tbl.view().to_dict()["a"] == [datetime(2019, 7, 12, 11, 30, 15, 120000)]
+
+    def test_update_np_datetime64_nat(self):
+        tbl = Table({"a": datetime, "b": int}, index="b")
+        tbl.update({
+            "a": np.array([datetime(2019, 7, 12, 11, 0), np.datetime64("nat")], dtype="datetime64[ns]"),
+            "b": np.array([1, 2])
+        })
+        assert tbl.view().to_dict()["a"] == [datetime(2019, 7, 12, 11, 0), None]
+
+        tbl.update({
+            "a": np.array([np.datetime64("nat")], dtype="datetime64[ns]"),
+            "b": np.array([1])
+        })
+        assert tbl.view().to_dict()["a"] == [None, None]
+
+    def test_update_np_datetime64_before_epoch(self):
+        tbl = Table({"a": datetime})
+        tbl.update({"a": np.array([datetime(1969, 12, 31, 23, 59, 59, 500000)], dtype="datetime64[us]")})
+        assert tbl.view().to_dict()["a"] == [datetime(1969, 12, 31, 23, 59, 59, 500000)]
+
+    def test_update_np_datetime64_to_date(self):
+        tbl = Table({"a": date})
+        tbl.update({
+            "a": np.array([
+                datetime(2019, 7, 12, 23, 0),
+                datetime(1900, 2, 28, 1, 0),
+                datetime(2000, 2, 29, 12, 0),
+                np.datetime64("nat")
+            ], dtype="datetime64[s]")
+        })
+
+        assert tbl.view().to_dict()["a"] == [
+            datetime(2019, 7, 12),
+            datetime(1900, 2, 28),
+            datetime(2000, 2, 29),
+            None
+        ]
+
+    def test_update_np_datetime64_D_before_epoch(self):
+        tbl = Table({
+            "a": np.array([date(1969, 12, 31), date(1600, 3, 1), np.datetime64("nat")], dtype="datetime64[D]")
+        })
+
+        assert tbl.schema() == {"a": date}
+        assert tbl.view().to_dict()["a"] == [datetime(1969, 12, 31), datetime(1600, 3, 1), None]
+
+    def test_update_np_int64_to_int32(self):
+        tbl = Table({"a": [1, 2]})
+        tbl.update({"a": np.array([3, -4], dtype=np.int64)})
+        assert tbl.view().to_dict()["a"] == [1, 2, 3, -4]
+
+    def test_update_np_int64_to_int32_out_of_range(self):
+        tbl = Table({"a": np.array([1, 2], dtype=np.int32)})
+        with raises(PerspectiveCppError):
+            tbl.update({"a": np.array([3, 2 ** 40], dtype=np.int64)})
+        assert tbl.view().to_dict()["a"] == [1, 2]
+
+    def test_update_np_float64_to_int32_inf(self):
+        tbl = Table({"a": np.array([1, 2], dtype=np.int32)})
+        with raises(PerspectiveCppError):
+            tbl.update({"a": np.array([3.0, np.inf])})
+        assert tbl.view().to_dict()["a"] == [1, 2]
+
+    def test_update_np_float64_to_int64_out_of_range(self):
+        tbl = Table({"a": np.array([1, 2], dtype=np.int64)})
+        with raises(PerspectiveCppError):
+            tbl.update({"a": np.array([3.0, 1e19])})
+        assert tbl.view().to_dict()["a"] == [1, 2]
+
+    def test_update_np_float64_to_int64_nan(self):
+        tbl = Table({"a": np.array([1, 2], dtype=np.int64)})
+        tbl.update({"a": np.array([3.0, np.nan, 5.9])})
+        assert tbl.view().to_dict()["a"] == [1, 2, 3, None, 5]
+
@@ -338,6 +338,26 @@ class TestView(object):
         assert view.column_paths() == order
 
     # row and column pivot paths
+    def test_view_row_pivot_many_leaves(self):
+        size = 100000
+        data = {
+            "a": [["x", "y", "w"][i % 3] for i in range(size)],
+            "b": [i % 2 for i in range(size)],
+            "c": [1 for i in range(size)]
+        }
+        tbl = Table(data)
+        view = tbl.view(row_pivots=["a", "b"], columns=["c"])
+        assert view.to_dict() == {
+            "__ROW_PATH__": [
+                [], ["w"], ["w", 0], ["w", 1], ["x"], ["x", 0], ["x", 1],
+                ["y"], ["y", 0], ["y", 1]
+            ],
+            "c": [
+                size, 33333, 16667, 16666, 33334, 16667, 16667, 33333, 16666,
+                16667
+            ]
+        }
+
     def test_view_row_pivot_datetime_row_paths_are_same_as_data(self):
         """Tests row paths for datetimes in UTC. Timezone-related tests are
         in the `test_table_datetime` file."""
@@ -507,6 +527,105 @@ class TestView(object):
             {"__ROW_PATH__": ["a"], "y": (1 * 200 + (-2) * 100) / (1 - 2)}
         ]
 
+    def test_view_aggregate_mean_update(self):
+        tbl = Table({
+            "k": [1, 2, 3, 4],
+            "a": ["a", "a", "b", "b"],
+            "y": [2, 4, 6, None]
+        }, index="k")
+        view = tbl.view(
+            aggregates={"y": "mean"},
+            row_pivots=["a"],
+            columns=["y"]
+        )
+
+        # update a value, fill a null and move a row to another pivot
+        tbl.update({"k": [1, 4, 3], "a": ["a", "b", "a"], "y": [8, 10, 6]})
+        assert view.to_records() == [
+            {"__ROW_PATH__": [], "y": 28 / 4},
+            {"__ROW_PATH__": ["a"], "y": 18 / 3},
+            {"__ROW_PATH__": ["b"], "y": 10 / 1}
+        ]
+
+        tbl.remove([1, 4])
+        assert view.to_records() == [
+            {"__ROW_PATH__": [], "y": 10 / 2},
+            {"__ROW_PATH__": ["a"], "y": 10 / 2}
+        ]
+
+        tbl.update({"k": [5], "a": ["b"], "y": [3]})
+        assert view.to_records() == [
+            {"__ROW_PATH__": [], "y": 13 / 3},
+            {"__ROW_PATH__": ["a"], "y": 10 / 2},
+            {"__ROW_PATH__": ["b"], "y": 3 / 1}
+        ]
+
+    def test_view_aggregate_mean_update_nan(self):
+        tbl = Table({
+            "k": [1, 2],
+            "a": ["a", "a"],
+            "y": [1.5, float("nan")]
+        }, index="k")
+        view = tbl.view(
+            aggregates={"y": "mean"},
+            row_pivots=["a"],
+            columns=["y"]
+        )
+        tbl.update({"k": [2], "y": [2.5]})
+        assert view.to_records() == [
+            {"__ROW_PATH__": [], "y": 2},
+            {"__ROW_PATH__": ["a"], "y": 2}
+        ]
+
+    def test_view_aggregate_max_min_update(self):
+        tbl = Table({
+            "k": [1, 2, 3, 4],
+            "a": ["a", "a", "b", "b"],
+            "y": [2, 9, 6, None]
+        }, index="k")
+        high = tbl.view(aggregates={"y": "max"}, row_pivots=["a"], columns=["y"])
+        low = tbl.view(aggregates={"y": "min"}, row_pivots=["a"], columns=["y"])
+
+        # lower the max of "a", fill a null and move a row to another pivot
+        tbl.update({"k": [2, 4, 3], "a": ["a", "b", "a"], "y": [1, 7, 6]})
+        assert high.to_dict()["y"] == [7, 6, 7]
+        assert low.to_dict()["y"] == [1, 1, 7]
+
+        tbl.remove([4])
+        assert high.to_dict()["y"] == [6, 6]
+        assert low.to_dict()["y"] == [1, 1]
+
+        tbl.update({"k": [5, 1], "a": ["b", "a"], "y": [3, 0]})
+        assert high.to_dict()["y"] == [6, 6, 3]
+        assert low.to_dict()["y"] == [0, 0, 3]
+
+    def test_view_aggregate_weighted_mean_update(self):
+        tbl = Table({
+            "k": [1, 2, 3],
+            "a": ["a", "a", "b"],
+            "x": [1, 2, 3],
+            "y": [200, 100, None]
+        }, index="k")
+        view = tbl.view(
+            aggregates={"y": ["weighted mean", "x"]},
+            row_pivots=["a"],
+            columns=["y"]
+        )
+
+        tbl.update({"k": [2, 3], "x": [3, 1], "y": [100, 300]})
+        assert view.to_records() == [
+            {"__ROW_PATH__": [], "y": (1.0 * 200 + 3 * 100 + 1 * 300) / (1 + 3 + 1)},
+            {"__ROW_PATH__": ["a"], "y": (1.0 * 200 + 3 * 100) / (1 + 3)},
+            {"__ROW_PATH__": ["b"], "y": 300.0}
+        ]
+
+        tbl.update({"k": [1], "a": ["b"]})
+        tbl.remove([2])
+        assert view.to_records() == [
+            {"__ROW_PATH__": [], "y": (1.0 * 200 + 1 * 300) / (1 + 1)},
+            {"__ROW_PATH__": ["b"], "y": (1.0 * 200 + 1 * 300) / (1 + 1)}
+        ]
+
     # sort
 
     def test_view_sort_int(self):
@@ -545,6 +664,81 @@ class TestView(object):
         view = tbl.view(sort=[["a", "desc"]], columns=["b"])
         assert view.to_records() == [{"b": 4}, {"b": 2}]
 
+    def test_view_sort_multiple_with_nulls(self):
+        data = {
+            "a": ["b", "a", "b", None, "a"],
+            "b": [1, 2, 0, 5, None]
+        }
+        tbl = Table(data)
+        view = tbl.view(sort=[["a", "asc"], ["b", "desc"]])
+        assert view.to_dict() == {
+            "a": [None, "a", "a", "b", "b"],
+            "b": [5, 2, None, 1, 0]
+        }
+
+    def test_view_sort_desc_abs(self):
+        data = {"a": [-3, 2, 3, -1]}
+        tbl = Table(data)
+        view = tbl.view(sort=[["a", "desc abs"]])
+        assert view.to_dict() == {"a": [3, -3, 2, -1]}
+
+    def test_view_sort_limit(self):
+        data = {"a": [5, 1, 4, 2, 3], "b": ["a", "b", "c", "d", "e"]}
+        tbl = Table(data)
+        view = tbl.view(sort=[["a", "desc"]], limit=3)
+        assert view.num_rows() == 3
+        assert view.to_dict() == {"a": [5, 4, 3], "b": ["a", "c", "e"]}
+
+    def test_view_sort_limit_filter(self):
+        data = {"a": [5, 1, 4, 2, 3], "b": ["a", "b", "c", "d", "e"]}
+        tbl = Table(data)
+        view = tbl.view(sort=[["a", "asc"]], filter=[["a", ">", 1]], limit=2)
+        assert view.to_dict() == {"a": [2, 3], "b": ["d", "e"]}
+
+    def test_view_sort_limit_update(self):
+        data = {"k": [0, 1, 2, 3, 4], "a": [5, 1, 4, 2, 3]}
+        tbl = Table(data, index="k")
+        view = tbl.view(sort=[["a", "desc"]], limit=2)
+        assert view.to_dict() == {"k": [0, 2], "a": [5, 4]}
+
+        # a row leaves the top, and is replaced by a row outside of it
+        tbl.update({"k": [0], "a": [0]})
+        assert view.to_dict() == {"k": [2, 4], "a": [4, 3]}
+
+        tbl.remove([2])
+        assert view.to_dict() == {"k": [4, 3], "a": [3, 2]}
+
+        # a row outside of the top enters it
+        tbl.update({"k": [1], "a": [10]})
+        assert view.to_dict() == {"k": [1, 4], "a": [10, 3]}
+
+        tbl.update({"k": [5, 6], "a": [7, -1]})
+        assert view.to_dict() == {"k": [1, 5], "a": [10, 7]}
+
+    def test_view_sort_limit_remove_top(self):
+        tbl = Table({"k": list(range(20)), "a": list(range(20))}, index="k")
+        view = tbl.view(sort=[["a", "asc"]], limit=3)
+
+        # the reserve behind the top replaces the removed rows, until it is
+        # exhausted and the rows outside of it are scanned again
+        for k in range(12):
+            tbl.remove([k])
+            assert view.to_dict() == {"k": [k + 1, k + 2, k + 3], "a": [k + 1, k + 2, k + 3]}
+
+        tbl.remove(list(range(12, 18)))
+        assert view.to_dict() == {"k": [18, 19], "a": [18, 19]}
+
+    def test_view_sort_limit_matches_sort(self):
+        tbl = Table({"k": list(range(100)), "a": [(i * 37) % 101 for i in range(100)]}, index="k")
+        view = tbl.view(sort=[["a", "asc"]], limit=10)
+        full = tbl.view(sort=[["a", "asc"]])
+        for i in range(50):
+            if i % 3 == 0:
+                tbl.remove([(i * 7) % 100])
+            else:
+                tbl.update({"k": [(i * 11) % 100], "a": [(i * 53) % 97]})
+            assert view.to_dict() == full.to_dict(end_row=10)
+
     def test_view_sort_avg_nan(self):
         data = {
             "w": [3.5, 4.5, None, None, None, None, 1.5, 2.5],
@@ -771,6 +965,26 @@ class TestView(object):
         tbl.update(data)
         assert s.get() is True
 
+    def test_view_update_unread_columns(self):
+        tbl = Table({"a": [1, 2], "b": ["x", "y"], "c": [1.5, 2.5], "d": [1, 2]}, index="a")
+        flat = tbl.view(
+            columns=["a", "computed"],
+            computed_columns=[
+                {
+                    "column": "computed",
+                    "computed_function_name": "+",
+                    "inputs": ["c", "d"],
+                }
+            ]
+        )
+        pivot = tbl.view(row_pivots=["b"], columns=["c"])
+        tbl.update({"a": [1], "d": [10]})
+        assert flat.to_dict() == {"a": [1, 2], "computed": [11.5, 4.5]}
+        assert pivot.to_dict() == {"__ROW_PATH__": [[], ["x"], ["y"]], "c": [4, 1.5, 2.5]}
+        tbl.update({"a": [2], "c": [5.5]})
+        assert flat.to_dict() == {"a": [1, 2], "computed": [11.5, 7.5]}
+        assert pivot.to_dict() == {"__ROW_PATH__": [[], ["x"], ["y"]], "c": [7, 1.5, 5.5]}
+
     def test_view_on_update_multiple_callback(self, sentinel):
         s = sentinel(0)
 
@@ -1466,6 +1680,40 @@ class TestView(object):
         view = tbl.view(column_pivots=["c"])
         assert view.expand(0) == 0
 
+    def test_view_expand_after_update_median(self):
+        data = {"a": ["x", "x", "y", "y"], "b": ["p", "q", "p", "q"], "c": [1, 2, 3, 4]}
+        tbl = Table(data)
+        view = tbl.view(row_pivots=["a", "b"], columns=["c"], aggregates={"c": "median"})
+        view.set_depth(0)
+        tbl.update({"a": ["x"], "b": ["p"], "c": [10]})
+        assert view.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["y"]],
+            "c": [3, 2, 4]
+        }
+        view.expand(1)
+        assert view.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["x", "p"], ["x", "q"], ["y"]],
+            "c": [3, 2, 10, 2, 4]
+        }
+
+    def test_view_sum_count_new_nodes(self):
+        data = {"a": ["x", "x", "y"], "b": [1.5, None, 2], "c": [1, 2, 3]}
+        tbl = Table(data)
+        view = tbl.view(row_pivots=["a"], aggregates={"a": "count", "b": "sum", "c": "sum"})
+        assert view.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["y"]],
+            "a": [3, 2, 1],
+            "b": [3.5, 1.5, 2],
+            "c": [6, 3, 3]
+        }
+        tbl.update({"a": ["y", "z", "z"], "b": [2.5, 4, None], "c": [None, 5, 6]})
+        assert view.to_dict() == {
+            "__ROW_PATH__": [[], ["x"], ["y"], ["z"]],
+            "a": [6, 2, 2, 2],
+            "b": [10, 1.5, 4.5, 4],
+            "c": [17, 3, 3, 11]
+        }
+
     # view config validation
 
     def test_invalid_column_should_throw(self):
@@ -51,14 +51,38 @@ class PerspectiveTornadoHandler(tornado.websocket.WebSocketHandler):
             chunk_size (:obj:`int`): Binary messages will not exceed this length
                 (in bytes);  payloads above this limit will be chunked
                 across multiple messages. Defaults to `25165824` (24MB), and
-                be disabled entirely with `None`.
+                be disabled entirely with `None`. Binary frames of the
+                manager protocol are chunked the same way, and can be
+                reassembled from the lengths in the frame's prefix.
+            max_pending_writes (:obj:`int`): When more messages than this
+                have been posted but not yet written to the client, the
+                `on_update` notifications of its subscriptions are coalesced
+                into one until it catches up. Defaults to `16`, and can be
+                disabled entirely with `None`.
+            max_update_rate (:obj:`float`): If set, the maximum number of
+                `on_update` notifications per second sent for each of the
+                client's subscriptions - notifications in between are
+                coalesced. Defaults to `None`.
         """
         self._manager = kwargs.pop("manager", None)
         self._check_origin = kwargs.pop("check_origin", False)
         self._chunk_size = kwargs.pop("chunk_size", 25165824)
+        self._max_pending_writes = kwargs.pop("max_pending_writes", 16)
+        self._max_update_rate = kwargs.pop("max_update_rate", None)
         self._session = self._manager.new_session()
         self._stream_lock = tornado.locks.Lock()
 
+        # The number of messages posted but not yet written, and whether the
+        # session's updates are paused until they are.
+        self._pending_writes = 0
+        self._updates_paused = False
+
+        if self._max_pending_writes is not None or self._max_update_rate is not None:
+            self._session.set_update_throttle(
+                max_update_rate=self._max_update_rate,
+                call_later=IOLoop.current().call_later,
+            )
+
         # https://www.tornadoweb.org/en/stable/gen.html#tornado.gen.moment
         self._chunk_sleep = kwargs.pop("_chunk_sleep", 0)
 
@@ -104,6 +128,15 @@ class PerspectiveTornadoHandler(tornado.websocket.WebSocketHandler):
         """
         loop = IOLoop.current()
 
+        self._pending_writes += 1
+        if (
+            self._max_pending_writes is not None
+            and self._pending_writes > self._max_pending_writes
+            and not self._updates_paused
+        ):
+            self._updates_paused = True
+            self._session.pause_updates()
+
         # Only send message in chunks if it passes the threshold set by the
         # `PerspectiveManager`.
         chunked = len(message) > self._chunk_size
@@ -139,6 +172,15 @@ class PerspectiveTornadoHandler(tornado.websocket.WebSocketHandler):
             pass
         finally:
             yield self._stream_lock.release()
+            self._on_write_done()
+
+    def _on_write_done(self):
+        """Resume the session's updates once the client has caught up with
+        every message posted to it."""
+        self._pending_writes -= 1
+        if self._updates_paused and self._pending_writes == 0:
+            self._updates_paused = False
+            self._session.resume_updates()
 
     @coroutine
     def _post_chunked(self, message, start, end, message_length):